@@ -0,0 +1,42 @@
+#!/usr/bin/env bash
+# Builtin cat against /bin/cat, on one large file and many tiny ones.
+#   bench/cat.sh [megabytes] [runs]
+# The large file is copied to a file (copy_file_range) and through a
+# pipe (splice). The tiny files are read by one cat given all of them,
+# then by one cat each from a loop, where the fork+exec of /bin/cat is
+# what the builtin saves. TINY sets the number of tiny files.
+set -eu
+
+SH=${MINISHELL:-$(cd "$(dirname "$0")/.." && pwd)/minishell}
+MB=${1:-1024}
+RUNS=${2:-3}
+TINY=${TINY:-2000}
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+
+head -c $((MB * 1024 * 1024)) /dev/urandom > "$DIR/big"
+mkdir "$DIR/tiny"
+seq 1 "$TINY" | (cd "$DIR/tiny" && while read -r i; do
+	echo "line $i" > "$i"; done)
+
+# Median and minimum ms of RUNS runs of command $2, labelled $1
+run() {
+	local t0 t1 r
+	for r in $(seq 1 "$RUNS"); do
+		rm -f "$DIR/out"
+		t0=$EPOCHREALTIME
+		echo "cd $DIR; $2" | "$SH" > /dev/null
+		t1=$EPOCHREALTIME
+		echo $(( (${t1/./} - ${t0/./}) / 1000 ))
+	done | sort -n | awk -v l="$1" '{ v[NR] = $1 }
+		END { printf "%-24s median %6d ms, min %6d ms\n",
+			l, v[int((NR + 1) / 2)], v[1] }'
+}
+
+echo "${MB}MB file, $TINY tiny files, $RUNS runs"
+for c in cat /bin/cat; do
+	run "$c big > out" "$c big > out"
+	run "$c big | wc -c" "$c big | wc -c"
+	run "$c tiny/*" "$c tiny/*"
+	run "loop of $c" "for f in tiny/*; do $c \$f; done"
+done
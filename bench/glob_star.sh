@@ -0,0 +1,49 @@
+#!/usr/bin/env bash
+# ** walk with one thread against many.
+#   bench/glob_star.sh [threads] [runs]
+# Builds DIRS directories of FILES files each, half of them *.o, in a
+# temporary tree and times `echo **/*.o` in a fresh minishell per run,
+# so the glob listing cache starts empty every time. COLD=1 drops the
+# page cache before each run (root only), which is where overlapping
+# the walkers' getdents() can pay off.
+set -eu
+
+SH=${MINISHELL:-$(cd "$(dirname "$0")/.." && pwd)/minishell}
+THREADS=${1:-8}
+RUNS=${2:-5}
+DIRS=${DIRS:-1000}
+FILES=${FILES:-100}
+TREE=$(mktemp -d)
+trap 'rm -rf "$TREE"' EXIT
+
+# Directory n sits below directory n/10: 123 is 1/2/3
+seq 1 "$DIRS" | awk '{ s = ""; for (n = $1; n > 0; n = int(n / 10))
+	s = (n % 10) "/" s; print s }' > "$TREE/.dirs"
+(cd "$TREE" && xargs mkdir -p < .dirs)
+while read -r d; do
+	for i in $(seq 1 "$FILES"); do
+		if [ $((i % 2)) = 0 ]; then echo "$d$i.o"; else echo "$d$i.c"; fi
+	done
+done < "$TREE/.dirs" | (cd "$TREE" && xargs touch)
+
+# Median and minimum wall time, in ms, of RUNS runs with $1 walkers
+run() {
+	local t0 t1 r
+	for r in $(seq 1 "$RUNS"); do
+		if [ "${COLD:-0}" = 1 ]; then
+			sync
+			echo 3 > /proc/sys/vm/drop_caches
+		fi
+		t0=$EPOCHREALTIME
+		MINISHELL_GLOB_THREADS=$1 "$SH" <<< "cd $TREE; echo **/*.o" \
+			> /dev/null
+		t1=$EPOCHREALTIME
+		echo $(( (${t1/./} - ${t0/./}) / 1000 ))
+	done | sort -n | awk -v t="$1" '{ v[NR] = $1 }
+		END { printf "%2d thread(s): median %d ms, min %d ms\n",
+			t, v[int((NR + 1) / 2)], v[1] }'
+}
+
+echo "$(nproc) cpu(s), $DIRS dirs x $FILES files, $RUNS runs, cold=${COLD:-0}"
+run 1
+run "$THREADS"
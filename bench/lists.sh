@@ -0,0 +1,39 @@
+#!/usr/bin/env bash
+# a && b && c chains, builtin and external.
+#   bench/lists.sh [lines] [runs]
+# Feeds LINES copies of each chain to one minishell as a script and
+# reports the cost of one list. Builtin chains run in the shell with no
+# fork; the external one pays a fork+exec per list, so it gets a tenth
+# of the lines. SHELLS="bash dash" times the same scripts under them.
+set -eu
+
+SH=${MINISHELL:-$(cd "$(dirname "$0")/.." && pwd)/minishell}
+LINES=${1:-20000}
+RUNS=${2:-5}
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+
+yes 'x=1 && echo a && pwd' | head -n "$LINES" > "$DIR/builtin"
+yes 'cd /nonexistent || cd /nonexistent || x=2' | head -n "$LINES" > "$DIR/or"
+yes 'x=1 && /bin/true && echo a' | head -n $((LINES / 10)) > "$DIR/external"
+
+# Median and minimum ns per list of RUNS runs of script $2 under $1
+run() {
+	local t0 t1 r n
+	n=$(wc -l < "$2")
+	for r in $(seq 1 "$RUNS"); do
+		t0=$EPOCHREALTIME
+		"$1" < "$2" > /dev/null 2>&1
+		t1=$EPOCHREALTIME
+		echo $(( (${t1/./} - ${t0/./}) * 1000 / n ))
+	done | sort -n | awk -v s="$(basename "$1")" -v f="$(basename "$2")" \
+		'{ v[NR] = $1 } END { printf "%-10s %-9s median %7d ns, min %7d ns\n",
+		s, f, v[int((NR + 1) / 2)], v[1] }'
+}
+
+echo "$LINES lists, $RUNS runs, per list"
+for s in "$SH" ${SHELLS:-}; do
+	for f in builtin or external; do
+		run "$s" "$DIR/$f"
+	done
+done
@@ -0,0 +1,30 @@
+#!/usr/bin/env bash
+# Per-iteration cost of a loop whose body only runs builtins.
+#   bench/loop.sh [iterations] [runs]
+# The body is parsed once, so this is expansion and dispatch alone:
+# a rise here means something went back to lexing or forking per pass.
+# SHELLS="bash dash" times the same script under other shells too.
+set -eu
+
+SH=${MINISHELL:-$(cd "$(dirname "$0")/.." && pwd)/minishell}
+ITER=${1:-100000}
+RUNS=${2:-5}
+SCRIPT='for i in $(seq 1 '$ITER'); do x=$i; echo "$x"; done'
+
+# Median and minimum ns per iteration of RUNS runs under $1
+run() {
+	local t0 t1 r
+	for r in $(seq 1 "$RUNS"); do
+		t0=$EPOCHREALTIME
+		printf '%s\n' "$SCRIPT" | "$1" > /dev/null
+		t1=$EPOCHREALTIME
+		echo $(( (${t1/./} - ${t0/./}) * 1000 / ITER ))
+	done | sort -n | awk -v s="$(basename "$1")" '{ v[NR] = $1 }
+		END { printf "%-10s median %6d ns, min %6d ns\n",
+			s, v[int((NR + 1) / 2)], v[1] }'
+}
+
+echo "$ITER iterations, $RUNS runs, per iteration"
+for s in "$SH" ${SHELLS:-}; do
+	run "$s"
+done
@@ -0,0 +1,38 @@
+#!/usr/bin/env bash
+# Pipeline throughput at 64K, 1M and adaptive pipe buffers.
+#   bench/pipe_size.sh [megabytes] [runs]
+# Times two bulk pipelines under MINISHELL_PIPE_SIZE: one passing a
+# stream straight through, and one with gzip on both ends, where a
+# small pipe means a context switch per 64K. The gzip input is random
+# text compressed once up front, so it is the same for every run.
+set -eu
+
+SH=${MINISHELL:-$(cd "$(dirname "$0")/.." && pwd)/minishell}
+MB=${1:-300}
+RUNS=${2:-3}
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+
+head -c $((MB * 1024 * 1024 * 3 / 4)) /dev/urandom | base64 -w 76 \
+	| gzip -1 > "$DIR/data.gz"
+
+# Median and minimum ms of RUNS runs of pipeline $2 with pipe size $1
+run() {
+	local t0 t1 r
+	for r in $(seq 1 "$RUNS"); do
+		t0=$EPOCHREALTIME
+		echo "$2" | MINISHELL_PIPE_SIZE=$1 "$SH" > /dev/null
+		t1=$EPOCHREALTIME
+		echo $(( (${t1/./} - ${t0/./}) / 1000 ))
+	done | sort -n | awk -v s="$1" -v p="$3" '{ v[NR] = $1 }
+		END { printf "%-8s %-5s median %6d ms, min %6d ms\n",
+			p, s, v[int((NR + 1) / 2)], v[1] }'
+}
+
+echo "$(nproc) cpu(s), ${MB}MB, $RUNS runs"
+for size in 64K 1M auto; do
+	run "$size" "yes | head -c ${MB}M | wc -l" stream
+done
+for size in 64K 1M auto; do
+	run "$size" "gzip -dc $DIR/data.gz | gzip -1 -c | wc -c" gzip
+done
@@ -6,13 +6,16 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/21 20:44:55 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/02/16 17:09:31 by abroslav         ###   ########.fr       */
+/*   Updated: 2026/10/19 13:52:47 by abroslav         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef MINISHELL_H
 # define MINISHELL_H
 
+# ifndef _GNU_SOURCE
+#  define _GNU_SOURCE			// memfd_create, pipe2, F_GETPIPE_SZ
+# endif
 # include "../libft/libft.h"
 # include <readline/readline.h> // rl*
 # include <readline/history.h>	// add_history
@@ -29,6 +32,18 @@
 # include <limits.h>			//atoll
 # include <sys/types.h>			//stat struct
 # include <sys/stat.h>			//permissoes de ficheiro - erro 126 - 127
+# include <sys/mman.h>			//memfd_create
+# include <dirent.h>			//opendir, readdir, DT_DIR
+# include <pthread.h>			//pthread_create, mutexes for ** walks
+# include <sched.h>				//sched_yield, sched_setaffinity
+# include <sys/syscall.h>		//SYS_ioprio_set
+# include <time.h>				//clock_gettime
+# include <sys/sendfile.h>		//sendfile
+# include <sys/timerfd.h>		//timerfd_create
+# include <sys/signalfd.h>		//signalfd
+# include <poll.h>				//poll
+# include <math.h>				//sqrt
+# include <sys/resource.h>		//getrusage
 
 # ifndef PATH_MAX				//pwd
 #  define PATH_MAX 4096
@@ -44,6 +59,14 @@ typedef enum e_token_type
 	TK_REDIR_OUT,				// >
 	TK_APPEND,					// >>
 	TK_HEREDOC,					// <<
+	TK_HERESTR,					// <<<
+	TK_AND,						// &&
+	TK_OR,						// ||
+	TK_SEMI,					// ;
+	TK_LPAREN,					// (
+	TK_RPAREN,					// )
+	TK_NEWLINE,					// Newline ending a command, like ;
+	TK_FANOUT,					// |+ another reader of the same output
 }	t_token_type;
 
 typedef enum e_redir_type
@@ -52,12 +75,50 @@ typedef enum e_redir_type
 	REDIR_OUT,					// >
 	REDIR_APPEND,				// >>
 	REDIR_HEREDOC,				// <<
+	REDIR_HERESTR,				// <<<
 }	t_redir_type;
 
+typedef enum e_arith_op
+{
+	AR_OR,						// ||   Binary operators first, in the
+	AR_AND,						// &&   order of the arith_binop() table
+	AR_BOR,						// |
+	AR_XOR,						// ^
+	AR_BAND,					// &
+	AR_EQ,						// ==
+	AR_NE,						// !=
+	AR_LE,						// <=
+	AR_GE,						// >=
+	AR_LT,						// <
+	AR_GT,						// >
+	AR_SHL,						// <<
+	AR_SHR,						// >>
+	AR_ADD,						// +
+	AR_SUB,						// -
+	AR_MUL,						// *
+	AR_DIV,						// /
+	AR_MOD,						// %
+	AR_POW,						// **
+	AR_NUM,						// Integer constant
+	AR_VAR,						// Variable reference
+	AR_NEG,						// -x
+	AR_NOT,						// !x
+	AR_BNOT,					// ~x
+	AR_PREINC,					// ++x
+	AR_PREDEC,					// --x
+	AR_POSTINC,					// x++
+	AR_POSTDEC,					// x--
+	AR_ASSIGN,					// x = e, x += e, ...
+	AR_TERNARY,					// c ? a : b
+	AR_COMMA,					// a , b
+}	t_arith_op;
+
 typedef struct s_redir
 {
 	t_redir_type	type;		// Redirection type
-	char			*target;	// File name or delimiter
+	char			*target;	// File name or delimiter, as typed
+	char			*file;		// Target after expansion
+	char			*body;		// Heredoc lines read at parse time
 	struct s_redir	*next;		// Pointer for next redirection
 }	t_redir;
 
@@ -65,46 +126,446 @@ typedef struct s_token
 {
 	t_token_type	type;		// Token value
 	char			*value;		// Type of token
-	int				no_expand;	// Expand or not
-	int				in_dquotes;	// Came from double quotes?
 	struct s_token	*next;		// Pointer for next token
 }	t_token;
 
 typedef struct s_cmd
 {
-	char			**args;		// Command Args
+	char			**words;	// Words as typed, expanded on every run
+	char			**args;		// Command Args (expanded words)
 	t_redir			*redirs;	// Redirects list
 	char			**limits;	// Heredoc delimiters
 	int				heredoc_fd;	// FD for heredoc
+	struct s_node	*body;		// Compound command, words are unused
+	int				fanout;		// After |+, reads a copy of the producer
+	int				tee_fd;		// Closes when its multios pump is done
 	struct s_cmd	*next;		// Next command in pipe
 }	t_cmd;
 
+typedef enum e_node_type
+{
+	ND_PIPELINE,				// cmds
+	ND_AND,						// left && right
+	ND_OR,						// left || right
+	ND_SEQ,						// left ; right
+	ND_IF,						// if left; then right; else alt; fi
+	ND_WHILE,					// while left; do right; done
+	ND_UNTIL,					// until left; do right; done
+	ND_FOR,						// for name in cmds words; do right; done
+	ND_FUNC,					// name() body, defining func
+	ND_SUBSHELL,				// ( left )
+	ND_GROUP,					// { left ; }
+}	t_node_type;
+
+typedef struct s_node
+{
+	t_node_type		type;
+	t_cmd			*cmds;		// Pipeline of an ND_PIPELINE
+	struct s_node	*left;
+	struct s_node	*right;
+	struct s_node	*alt;		// else branch of an ND_IF, elif is an ND_IF
+	char			*name;		// "NAME=" an ND_FOR assigns to
+	struct s_func	*func;		// What an ND_FUNC defines
+}	t_node;
+
+# define FUNC_TABLE_SIZE 64		// Slots of the function table
+# define FUNC_MAX_DEPTH 1000	// Calls nested deeper are refused
+
+typedef struct s_func
+{
+	char			*name;
+	t_cmd			*body;		// Compound command, redirections included
+	int				refs;		// Table, parse tree and calls running it
+	struct s_func	*next;		// Next function in the same table slot
+}	t_func;
+
+typedef struct s_local
+{
+	char			*name;
+	char			*old;		// Entry as it was before, NULL when unset
+	struct s_local	*next;
+}	t_local;
+
+# define ALIAS_TABLE_SIZE 64		// Slots of the alias table
+# define ALIAS_MAX_DEPTH 16		// Aliases expanded into one another
+
+typedef struct s_alias
+{
+	char			*name;
+	char			*value;		// As given, for alias to print back
+	t_token			*tokens;	// value already through the lexer
+	struct s_alias	*next;		// Next alias in the same table slot
+}	t_alias;
+
+typedef struct s_frame
+{
+	char			**args;		// Call words: the name, then $1 $2 ...
+	t_local			*locals;	// Put back when the call returns
+	int				depth;		// 1 for a call from the top level
+	struct s_frame	*up;		// Frame of the caller
+}	t_frame;
+
+typedef struct s_hd_stream
+{
+	char	*delim;		// Delimiter the pump stops at
+	int		expand;		// Expand variables in the body
+	int		fd;			// Pipe write end, handed to the pump
+	pid_t	pid;		// Pump process, -1 when none is running
+}	t_hd_stream;
+
+typedef struct s_procsub
+{
+	pid_t				pid;	// Producer/consumer of <(cmd) / >(cmd)
+	int					fd;		// Our pipe end, seen as /dev/fd/N
+	struct s_procsub	*next;
+}	t_procsub;
+
+# define ARITH_CACHE_SIZE 16	// Compiled $((...)) kept for reuse
+
+typedef struct s_anode
+{
+	t_arith_op		op;
+	long long		num;	// AR_NUM value, AR_ASSIGN operator (-1 for =)
+	char			*name;	// Variable of AR_VAR, ++/-- and assignments
+	struct s_anode	*a;
+	struct s_anode	*b;
+	struct s_anode	*c;		// Else branch of ?:
+}	t_anode;
+
+typedef struct s_arith_slot
+{
+	char	*text;		// Expression after $ expansion
+	t_anode	*tree;		// Its compiled, constant folded form
+}	t_arith_slot;
+
+# define GLOB_CACHE_SIZE 64		// Directory listings kept for reuse
+
+typedef struct s_dent
+{
+	char			*name;
+	unsigned char	type;		// d_type, DT_UNKNOWN when the fs won't say
+}	t_dent;
+
+typedef struct s_dirlist
+{
+	dev_t			dev;		// Directory identity, checked on lookup
+	ino_t			ino;
+	struct timespec	mtime;		// Changes whenever an entry does
+	int				refs;		// Cache slot plus walks using it
+	char			*names;		// Every name, '\0' separated
+	t_dent			*ents;		// Sorted by name
+	size_t			count;
+}	t_dirlist;
+
+typedef struct s_argv
+{
+	char	**v;		// NULL terminated vector
+	int		len;
+	int		cap;
+}	t_argv;
+
 typedef struct s_shell
 {
 	char			**env_vars;		// Environment variables
 	int				exit_code;		// Exit code
 	t_token			*s_tokens;
-	t_cmd			*s_cmds;
+	t_node			*s_tree;		// Parsed command line
+	t_cmd			*s_cmds;		// Pipeline being run, within s_tree
+	t_hd_stream		hd_stream;		// Streamed heredoc of the pipeline
+	t_procsub		*procsubs;		// Process substitutions to reap
+	t_arith_slot	arith_cache[ARITH_CACHE_SIZE];
+	int				arith_next;		// Cache slot the next miss replaces
+	t_dirlist		*glob_cache[GLOB_CACHE_SIZE];
+	t_func			*funcs[FUNC_TABLE_SIZE];
+	t_alias			*aliases[ALIAS_TABLE_SIZE];
+	t_frame			*frame;			// Innermost function call running
+	char			**params;		// $1 $2 ..., NULL outside functions
+	int				returning;		// return ran, lists stop until the call
+	long			pipe_size;		// Of the running pipeline, -1 adaptive
+	struct s_stage	*stages;		// Its writers, sampled when adaptive
+	int				n_stages;
+	struct s_meter	*meters;		// Its meter stages, threads of the shell
+	struct stat		input;			// stdin at start, a script may be on it
+	int				substs;			// $(...) run expanding this pipeline
+	t_argv			hd_bodies;		// Heredoc bodies read before the parse
 }	t_shell;
 
+/* ===BUFFERS=== */
+# define BUF_MIN_CAP 64
+# define READER_BUFSZ 65536
+# define ARGV_MIN_CAP 8
+# define READER_LINE_CHUNK 4096	// Block size when the fd is shared
+# define READ_ALL_CHUNK 65536		// Minimum room per read() in read_all
+# define ANON_FILE_DIR "/dev/shm"	// O_TMPFILE fallback without memfd
+
+typedef struct s_buf
+{
+	char	*data;		// Bytes, always '\0' terminated when allocated
+	size_t	len;		// Used length
+	size_t	cap;		// Allocated size
+}	t_buf;
+
+typedef struct s_reader
+{
+	int		fd;
+	ssize_t	pos;					// Next byte to hand out
+	ssize_t	len;					// Valid bytes in data
+	ssize_t	chunk;					// Bytes asked per read()
+	char	data[READER_BUFSZ];
+}	t_reader;
+
+void	buf_init(t_buf *buf);
+int		buf_reserve(t_buf *buf, size_t extra);
+int		buf_append(t_buf *buf, const char *src, size_t n);
+char	*buf_release(t_buf *buf);
+void	buf_free(t_buf *buf);
+int		write_all(int fd, const char *src, size_t n);
+int		read_all(int fd, t_buf *out);
+int		anon_file(char *name);
+int		argv_push(t_argv *av, char *str);
+void	reader_init(t_reader *rd, int fd);
+void	reader_share(t_reader *rd, ssize_t chunk);
+void	reader_unread(t_reader *rd);
+int		reader_fill(t_reader *rd);
+int		reader_getc(t_reader *rd);
+char	*reader_line(t_reader *rd);
+
 /* ===LEXER=== */
-t_token	*lexer(char *input, t_shell *shell);
+t_token	*lexer(char *input);
 t_token	*new_token(char *value, t_token_type type);
 void	token_add_back(t_token **list, t_token *new_node);
 int		is_space(char c);
 int		is_special(char c);
 char	*join_and_free(char *s1, char *s2);
-char	*build_full_word(char *line, int *i, t_shell *shell, int *quoted);
+char	*build_raw_word(char *line, int *i);
+int		lex_blank(t_token **tokens, char *line, int *i);
+int		lex_skip_quote(char *line, int i);
+int		lex_skip_group(char *line, int i);
 
 /* ===EXPANDER=== */
-char	*expand_vars(char *str, char **env, int last_exit);
-void	expand_tokens(t_token *tokens, char **env, int last_exit);
+# define IFS_DEFAULT " \t\n"
+
+typedef struct s_wexp
+{
+	t_buf	out;		// Expanded text of the word
+	int		quoted;		// Had quotes: kept even when it expands to ""
+	t_argv	*fields;	// Unquoted expansions are split into here
+	int		pattern;	// Quoted glob characters get a '\' escape
+	t_shell	*shell;
+}	t_wexp;
+
+typedef struct s_param
+{
+	char	*inner;		// Text between ${ and }
+	char	*name;
+	char	*value;		// Value of name, NULL when unset
+	char	*op;		// Operator and word as typed, after the name
+	t_shell	*shell;
+}	t_param;
+
+char	*expand_vars(char *str, t_shell *shell);
+char	*expand_dollar(char *str, int *i, t_shell *shell);
+void	wexp_init(t_wexp *ex, t_shell *shell);
+int		expand_word(char *raw, t_wexp *ex);
+int		wexp_split(t_wexp *ex, char *value);
+int		wexp_quoted(t_wexp *ex, const char *src, size_t n);
+int		wexp_unquoted(t_wexp *ex, const char *src, size_t n);
+int		wexp_field_end(t_wexp *ex, t_argv *av);
+int		expand_to_argv(char *raw, t_argv *av, t_shell *shell);
+char	*expand_cmdsubst(char *str, int *i, t_shell *shell);
+char	*expand_param(char *str, int *i, t_shell *shell);
+char	*param_error(t_param *pm, char *msg);
+char	*param_word(t_param *pm, char *raw, int pattern);
+char	*param_default(t_param *pm, char *op, int colon);
+char	*param_substr(t_param *pm, char *spec);
+char	*param_strip(t_param *pm);
+ssize_t	param_affix_len(const char *pat, const char *v, int longest,
+			int suffix);
+char	*param_replace(t_param *pm);
+int		cmdsubst_fork(char *inner, t_buf *out, t_shell *shell);
+int		expand_cmd(t_cmd *cmd, t_shell *shell);
+int		expand_pipeline(t_cmd *cmds, t_shell *shell);
+int		expand_procsub(char *raw, int i, t_wexp *ex);
+char	*positional_get(t_shell *shell, int n);
+char	*positional_join(t_shell *shell);
+int		wexp_params(t_wexp *ex, int i);
+void	procsub_close_fds(t_shell *shell);
+void	procsub_release(t_shell *shell, int wait_them);
+
+/* ===ARITH=== */
+# define ARITH_MAX_DEPTH 64		// Variables evaluated inside variables
+
+typedef enum e_arith_err
+{
+	AE_OK,
+	AE_SYNTAX,
+	AE_DIVZERO,
+	AE_OVERFLOW,
+	AE_RANGE,
+	AE_DEPTH,
+	AE_NOMEM,
+}	t_arith_err;
+
+typedef struct s_arith
+{
+	const char	*s;			// Expression text
+	int			pos;		// Parse position in s
+	int			err;		// First t_arith_err met, AE_OK when none
+	int			depth;		// Nesting of variables holding expressions
+	t_shell		*shell;
+}	t_arith;
+
+char		*expand_arith(char *str, int *i, t_shell *shell);
+int			arith_value(char *text, t_shell *shell, long long *res);
+void		arith_cache_clear(t_shell *shell);
+void		arith_init(t_arith *ar, const char *s, t_shell *shell);
+void		arith_skip(t_arith *ar);
+t_anode		*arith_scan_number(t_arith *ar);
+char		*arith_scan_name(t_arith *ar);
+int			arith_assign_op(const char *s, long long *op);
+int			arith_binop(const char *s, t_arith_op *op, int *prec);
+int			arith_apply(t_arith_op op, long long a, long long b,
+				long long *res);
+int			arith_unary(t_arith_op op, long long a, long long *res);
+t_anode		*arith_fail(t_arith *ar, int err, t_anode *node);
+t_anode		*arith_leaf(t_arith *ar, t_arith_op op, long long num,
+				char *name);
+t_anode		*arith_node(t_arith *ar, t_arith_op op, t_anode *a, t_anode *b);
+void		arith_node_free(t_anode *node);
+t_anode		*arith_compile(t_arith *ar);
+t_anode		*arith_parse(t_arith *ar);
+t_anode		*arith_parse_binary(t_arith *ar, int min_prec);
+t_anode		*arith_parse_unary(t_arith *ar);
+long long	arith_eval(t_arith *ar, t_anode *node);
+long long	arith_var_get(t_arith *ar, char *name);
+void		arith_var_set(t_arith *ar, char *name, long long val);
+
+/* ===BRACES=== */
+typedef struct s_brace
+{
+	t_buf	word;		// Raw word produced so far
+	t_argv	*av;		// Finished words are expanded into it
+	t_shell	*shell;
+}	t_brace;
+
+typedef struct s_range
+{
+	long long	from;
+	long long	to;
+	long long	step;		// Signed, towards to
+	int			width;		// Zero padded width, 0 for none
+	int			letters;	// {a..z} rather than numbers
+}	t_range;
+
+int		expand_braces(char *raw, t_argv *av, t_shell *shell);
+int		brace_walk(t_brace *br, char *raw);
+int		brace_next(char *raw, int i);
+int		brace_list(t_brace *br, char *raw, int open, int close);
+int		brace_range_parse(char *s, int len, t_range *r);
+int		brace_range(t_brace *br, t_range *r, char *rest);
+
+/* ===GLOB=== */
+typedef struct s_glob
+{
+	t_buf	path;		// Directory being walked, '/' terminated
+	t_argv	*av;		// Matches go here, in walk order
+	int		found;
+	t_shell	*shell;
+}	t_glob;
+
+# define GLOB_MAX_THREADS 8		// Walkers for **, MINISHELL_GLOB_THREADS
+# define RWALK_OPEN_FLAGS	(O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC)
+
+typedef struct s_rdir
+{
+	DIR		*dir;		// Kept open while subdirectories need its fd
+	int		refs;		// Itself plus subdirectories not opened yet
+}	t_rdir;
+
+typedef struct s_rtask
+{
+	t_rdir	*parent;
+	char	*name;		// Directory to open, within parent
+	char	*path;		// Same, from the walk root, '/' terminated
+}	t_rtask;
+
+typedef struct s_rworker
+{
+	pthread_mutex_t	lock;		// Guards the deque, owner and thieves
+	t_rtask			*tasks;		// Owner works at the end, thieves at head
+	size_t			head;
+	size_t			len;
+	size_t			cap;
+	t_argv			found;		// Paths seen, directories '/' terminated
+	struct s_rwalk	*walk;
+	pthread_t		thread;
+	int				id;
+}	t_rworker;
+
+typedef struct s_rwalk
+{
+	t_rworker		*workers;
+	int				count;
+	int				pending;	// Tasks queued or running, 0 means done
+	int				queued;		// Tasks in a deque, not taken yet
+	int				root_fd;	// Fallback base when fds run out
+	int				err;
+	pthread_mutex_t	idle_lock;
+	pthread_cond_t	idle;		// Workers with nothing to take wait here
+}	t_rwalk;
+
+int		glob_match(const char *pat, const char *str, size_t len);
+int		glob_match_one(const char *pat, size_t *p, char c);
+ssize_t	glob_prefix(const char *pat, const char *v, size_t n);
+int		glob_found(const char *pat, const char *v, size_t n);
+ssize_t	glob_fixed_len(const char *pat);
+int		glob_has_meta(const char *pat, size_t len);
+char	*glob_unescape(const char *pat, size_t len);
+int		glob_field(char *pat, t_argv *av, t_shell *shell);
+int		glob_walk(t_glob *g, char *pat);
+int		glob_star(t_glob *g, char *rest);
+int		rwalk_run(const char *root, t_argv *out, t_shell *shell);
+void	*rwalk_worker(void *arg);
+void	rwalk_idle(t_rwalk *walk);
+void	rwalk_wake(t_rwalk *walk, int all);
+int		rq_push(t_rworker *w, t_rdir *parent, char *name, char *path);
+int		rq_pop(t_rworker *w, t_rtask *t);
+int		rq_steal(t_rworker *w, t_rtask *t);
+void	rdir_release(t_rdir *d);
+t_dirlist	*glob_dir(const char *path, t_shell *shell);
+t_dirlist	*dirlist_read(int fd);
+void	dirlist_release(t_dirlist *dl);
+void	glob_cache_clear(t_shell *shell);
 
 /* ===PARSER=== */
-t_cmd	*parser(t_token *tokens, t_shell *shell);
+typedef struct s_parse
+{
+	t_token	*tok;		// Next token to read
+	int		err;		// A syntax error was reported
+	int		open;		// Constructs and operators still waiting for input
+	int		*more;		// Set instead of an error when input ran out
+	t_shell	*shell;		// Aliases to expand
+}	t_parse;
+
+t_node	*parser(t_token *tokens, t_shell *shell, int *more);
+void	parse_error(t_parse *ps);
+int		parse_word_is(t_parse *ps, char *word);
+int		parse_list_end(t_parse *ps);
+int		parse_expect(t_parse *ps, char *word);
+t_node	*parse_list(t_parse *ps);
+t_cmd	*parse_command(t_parse *ps);
+t_node	*parse_clause(t_parse *ps, char **close);
+t_node	*parse_funcdef(t_parse *ps, char **close);
+void	parse_alias(t_parse *ps);
+t_alias	*alias_find(t_shell *shell, char *name);
+int		alias_set(t_shell *shell, char *name, char *value);
+int		alias_remove(t_shell *shell, char *name);
+void	alias_clear(t_shell *shell);
+t_node	*new_node(t_node_type type, t_node *left, t_node *right, t_cmd *cmds);
+void	free_tree(t_node *node);
 t_cmd	*new_cmd(void);
 void	cmd_add_back(t_cmd **list, t_cmd *new_node);
-void	cmd_add_arg(t_cmd *cmd, char *arg);
+void	cmd_add_word(t_cmd *cmd, char *word);
 void	redir_add_back(t_redir **list, t_redir *new_node);
 void	parse_redir_in(t_cmd *current_cmd, t_token **tokens);
 void	parse_redir_out(t_cmd *current_cmd, t_token **tokens);
@@ -115,21 +576,23 @@ void	print_cmds(t_cmd *cmd);
 void	free_tokens(t_token *list);
 void	free_cmds(t_cmd *cmds);
 int		ft_atoll_overflow(const char *str, long long *res);
+char	*ft_lltoa(long long n);
 void	free_all(t_shell *shell);
 void	cleanup_exit_child(t_shell *shell, int exit_code);
 int		is_valid_key(char *str);
 int		ft_strcmp(const char *s1, const char *s2);
 int		is_valid_n_flag(char *str);
 int		ft_isspace(int c);
-char	*special_expand_params(char c, int last_exit);
+char	*special_expand_params(char c, t_shell *shell);
 char	*read_line(void);
 int		validate_line(char *line, t_shell *shell);
-void	process_line(char *line, t_shell *shell);
+void	process_line(char *line, t_shell *shell, int *more);
 
 /* ===ENV=== */
 char	**copy_env(char **envp);
 void	free_env(char **env);
 char	*get_env_value(char **env, char *key);
+int		env_flag(char **env, char *key);
 int		ft_export(char **args, char ***env);
 int		ft_unset(char **args, char ***env);
 int		get_matrix_len(char **env);
@@ -145,31 +608,172 @@ void	setup_signals_execution(void);
 void	setup_signals_heredoc(void);
 
 /* === EXECUTION === */
+# define EXEC_ARG_MAX_DEFAULT 131072	// Used if sysconf(_SC_ARG_MAX) fails
+# define EXEC_ARG_HEADROOM 2048			// Room kept for auxv and alignment
+# define EXEC_ARG_STRLEN_MAX 131072		// Linux MAX_ARG_STRLEN
+# define STAGE_NUM_MAX 100000			// Numbers in stage options stop here
+# define STAGE_IOPRIO_WHO 1				// IOPRIO_WHO_PROCESS
+# define STAGE_IOPRIO_SHIFT 13			// IOPRIO_CLASS_SHIFT
+# define STAGE_IO_LEVEL 4				// ionice's default level
+
+# define PIPE_ADAPT_TICK_MS 10			// Stages are sampled this often
+# define PIPE_ADAPT_RATE 33554432		// Bytes/s that grow a stage's pipe
+# define PIPE_MAX_DEFAULT 1048576		// If pipe-max-size cannot be read
+# define TEE_CHUNK 65536				// Pump round without pipe size, buffer
+# define METER_CHUNK 1048576			// Most a meter moves per splice
+# define METER_TICK_MS 1000				// Progress line rate, stderr a tty
+# define CAT_CHUNK 16777216				// Most a kernel copy moves per call
+# define CAT_BUF 131072					// read/write fallback's buffer
+# define CAT_RW 0						// How cat copies a file: buffered,
+# define CAT_RANGE 1					// copy_file_range, file to file
+# define CAT_SPLICE 2					// splice, from or to a pipe
+# define CAT_SENDFILE 3					// sendfile, file to anything else
+
+/*A pipeline stage writing to a pipe, for the adaptive pipe size*/
+typedef struct s_stage
+{
+	pid_t			pid;
+	long			wchar;		// Bytes it had written at the last sample
+	long			size;		// Its pipe's buffer
+}	t_stage;
+
+/*A tee(2) pump copying one pipe to several outputs*/
+typedef struct s_tee
+{
+	int				in;			// Read end everything arrives on
+	int				*out;		// One per output, -1 once it is gone
+	int				*tmp;		// A private pipe per output, tee fills it
+	int				n;
+	int				null;		// /dev/null, the input's own copy goes
+	size_t			size;		// Bytes a round moves at most
+}	t_tee;
+
+/*A meter or cat stage the shell runs as a thread, from in to out*/
+typedef struct s_meter
+{
+	pthread_t		thread;
+	int				in;
+	int				out;
+	char			**files;	// cat's operands, NULL for a meter
+	char			*name;		// -n NAME, NULL without
+	long			bytes;
+	int				copy;		// splice refused, read/write from now on
+	int				status;
+	int				last;		// Ends the pipeline, sets its status
+	int				started;	// Its thread runs, to be joined
+	struct s_meter	*next;
+}	t_meter;
+
+/*What the pipeline optimizer changed for one run, undone afterwards*/
+typedef struct s_popt
+{
+	t_cmd			*fed;		// Took the dropped head's output as a redir
+	t_cmd			*cut;		// Trailing cat cut off the pipeline
+	t_cmd			*last;		// Command the cut cat hung from
+}	t_popt;
+
 void	executor(t_cmd *cmd, t_shell *shell);
+t_cmd	*pipe_opt(t_cmd *cmds, t_popt *opt, t_shell *shell);
+void	pipe_opt_undo(t_popt *opt, t_shell *shell);
+int		runs_forked(t_cmd *cmd, t_shell *shell);
+int		pipe_opt_is(t_cmd *cmd, char *name, t_shell *shell);
+int		pipe_opt_words(t_buf *buf, char **args);
+void	pipe_opt_dump(t_cmd *cmd, t_redir *redir, t_shell *shell);
+void	exec_tree(t_node *node, t_shell *shell);
+void	exec_while(t_node *node, t_shell *shell);
+void	exec_for(t_node *node, t_shell *shell);
+void	exec_subshell(t_node *body, t_shell *shell);
+t_func	*func_find(t_shell *shell, char *name);
+void	func_define(t_func *fn, t_shell *shell);
+void	func_release(t_func *fn);
+void	func_clear(t_shell *shell);
+void	func_call(t_func *fn, t_cmd *cmd, t_shell *shell);
+int		frame_save_local(t_frame *frame, char *name, t_shell *shell);
+int		exec_internal(t_cmd *cmd, t_shell *shell);
+int		exec_stopped(t_shell *shell);
 void	execute_pipe(t_cmd *cmd, t_shell *shell);
 char	*find_path(char *cmd, char **envp);
 void	free_tab(char **tab);
 int		is_right_assignment(char *str);
+int		exit_status_of(int status);
+int		report_status(int status);
+pid_t	spawn_cmd(t_cmd *cmd, t_shell *shell);
+int		run_cmd_sync(t_cmd *cmd, t_shell *shell);
+void	swap_job_signals(struct sigaction *old, int restore);
+long	exec_arg_budget(char **env);
+int		args_exceed_arg_max(char **args, char **env);
 void	execution_error(char *cmd, int code, t_shell *shell);
+int		cmd_error(char *cmd, char *arg, char *msg);
 void	handle_pipes(t_cmd *cmd, int fd_in, int *fd_pipe);
 int		handle_redirection(t_cmd *cmd);
 void	child_process(t_cmd *cmd, int fd_ind, int *fd_pipe, t_shell *shell);
+void	tee_run(t_tee *tee);
+int		tee_init(t_tee *tee, t_redir *redir);
+void	tee_keep(t_tee *tee, t_redir *redir);
+int		tee_start(t_cmd *cmd, t_tee *tee);
+void	tee_drop(t_tee *tee);
+void	tee_wait(t_cmd *cmd);
+void	tee_detach(t_cmd *cmd, t_shell *shell);
+t_cmd	*pipe_inline(t_cmd *cmd, int *fd_in, pid_t *pid, t_shell *sh);
+int		meter_copy(t_meter *m);
+long	meter_ms(struct timespec *since);
+void	meter_num(t_buf *b, long n, int width);
+void	meter_report(t_meter *m, struct timespec *start, char *end);
+t_cmd	*meter_start(t_cmd *cmd, int *fd_in, t_shell *shell);
+void	meter_run(t_shell *shell);
+int		meter_join(t_shell *shell);
+void	meter_drop(t_shell *shell);
+long	pipe_size_parse(char *s);
+long	pipe_max_size(void);
+void	pipe_size_start(t_cmd *cmd, t_shell *shell);
+int		pipe_open(int *fd_pipe, t_shell *shell);
+void	pipe_track(int fd, pid_t pid, t_shell *shell);
+void	pipe_adapt_wait(pid_t last, int *status, t_shell *shell);
+void	stage_prefix(t_cmd *cmd, t_shell *shell);
+void	stage_policy(t_cmd *cmd, t_shell *shell);
+int		stage_cpulist(char *s, cpu_set_t *set);
+int		stage_nth_cpu(cpu_set_t *set, int n);
+int		stage_ioprio(char *s);
+int		stage_nice(char *s, int *inc);
 
 /* === HEREDOC === */
+# define HD_SPILL_SIZE 1048576		// Body kept in memory up to this size
+# define HD_PIPE_MAX 1048576		// Never try a pipe above this size
+# define HD_STREAM_CHUNK 65536		// Pump writes to the pipe in this size
+
 typedef struct s_hd_ctx
 {
-	int		fd;
+	t_buf	body;		// Body bytes not yet written out
+	int		fd;			// memfd the body spilled into, -1 while in memory
 	int		expand;
-	char	**env;
-	int		exit_code;
+	t_shell	*shell;
 }	t_hd_ctx;
 
-int		handle_heredoc(char *delimiter, char **env, int last_exit);
-void	process_heredocs(t_cmd *cmds, char **env, int last_exit);
+typedef struct s_hd_walk
+{
+	t_argv	*bodies;	// Read ahead, handed out in source order
+	int		next;		// Heredoc the walk is at
+	int		err;		// Interrupted, the line must not run
+	t_node	*tree;
+	t_shell	*shell;
+}	t_hd_walk;
+
+int		handle_heredoc(char *delimiter, t_shell *shell);
+char	*heredoc_body(char *delimiter);
+int		heredoc_replay(char *delimiter, char *body, t_shell *shell);
+int		heredoc_attach(t_node *tree, t_shell *shell);
+int		heredoc_pending(t_token *tok, t_shell *shell);
+void	heredoc_bodies_clear(t_shell *shell);
+void	process_heredocs(t_cmd *cmds, t_shell *shell);
 int		heredoc_has_quotes(char *delimiter);
 char	*heredoc_remove_quotes(char *delimiter);
-char	*heredoc_gen_temp_filename(void);
-char	*heredoc_read_line(void);
+int		heredoc_write(t_hd_ctx *ctx, char *str, size_t len);
+int		heredoc_deliver(t_hd_ctx *ctx);
+int		heredoc_stream_wanted(t_cmd *cmds, t_redir *redir, t_shell *shell);
+int		heredoc_stream_open(char *delimiter, t_shell *shell);
+void	heredoc_stream_start(t_shell *shell);
+void	heredoc_stream_finish(t_cmd *cmds, t_shell *shell);
+void	close_heredoc_fds(t_cmd *cmds);
 void	heredoc_eof_warning(char *delimiter);
 
 /* === BUILTINS  === */
@@ -181,4 +785,163 @@ int		ft_env(char **args, char **env);
 int		ft_exit(char **args, t_shell *shell);
 int		ft_cd(char **args, char ***env);
 
+/* === XARGS === */
+# define XARGS_MIN_SLOTS 64
+
+typedef struct s_xargs
+{
+	char	**argv;			// Batch: command prefix + input args
+	int		prefix;			// Command words at the start of argv
+	int		count;			// Words currently in argv
+	int		cap;			// Allocated slots in argv
+	long	base;			// Bytes used by the prefix alone
+	long	used;			// Bytes used by the whole batch
+	long	limit;			// Byte budget for one execve()
+	int		max_args;		// -n: input args per batch, 0 = no limit
+	int		nul_mode;		// -0: input args are '\0' terminated
+	int		no_run_empty;	// -r: do not run at all on empty input
+	int		ran;			// At least one batch was executed
+	int		status;			// Aggregate exit status
+}	t_xargs;
+
+/* === TIMEOUT === */
+# define TIMEOUT_STATUS 124				// The command ran out of time
+# define TIMEOUT_FAIL 125				// timeout itself failed
+# define TO_PIDFD 0						// Polled: the command's pidfd,
+# define TO_TIMER 1						// the timerfd for each deadline,
+# define TO_SIGFD 2						// signals passed on to the group
+
+typedef struct s_timeout
+{
+	pid_t			pid;		// Leads the command's process group
+	pid_t			pgrp;		// The shell's, given the terminal back
+	int				tty;		// The command's group holds the terminal
+	struct pollfd	fds[3];		// TO_PIDFD, TO_TIMER and TO_SIGFD
+	int				sig;		// -s, sent when time is up
+	struct timespec	limit;
+	struct timespec	kill_after;	// -k, then SIGKILL; 0 for never
+	int				expired;
+	int				killed;
+}	t_timeout;
+
+int		timeout_duration(char *s, struct timespec *ts);
+int		timeout_run(t_timeout *t, t_cmd *cmd, t_shell *shell);
+void	timeout_send(t_timeout *t, int sig);
+void	timeout_arm(t_timeout *t, struct timespec *ts);
+void	timeout_expire(t_timeout *t);
+int		timeout_open(t_timeout *t, sigset_t *set);
+void	timeout_close(t_timeout *t);
+int		ft_timeout(char **args, t_shell *shell);
+/* === MEMO === */
+# define MEMO_MAX_DEFAULT 16777216		// Largest output kept
+# define MEMO_SIZE_DEFAULT 268435456	// Whole cache, least used go first
+# define MEMO_HDR "memo1 000\n"			// Status, then the output
+# define MEMO_HDR_LEN 10
+# define MEMO_NAME_LEN 32				// Hex digits of an entry's key
+# define MEMO_FNV_BASIS 14695981039346656037UL
+# define MEMO_FNV_PRIME 1099511628211UL
+# define MEMO_MIX 11400714819323198485UL	// 2^64 / golden ratio
+
+typedef struct s_memo
+{
+	uint64_t		a;			// Two 64 bit hashes of every input,
+	uint64_t		b;			// the entry's name in hex
+	struct timespec	ttl;		// --ttl, 0 for entries that never expire
+	int				in;			// stdin as read into the key, -1 if not
+	int				over;		// stdin ran past max, the run is uncached
+	long			max;		// MINISHELL_MEMO_MAX, output kept at most
+	long			size;		// MINISHELL_MEMO_SIZE, the whole cache
+	char			*dir;
+	char			*path;		// The entry for this key
+}	t_memo;
+
+typedef struct s_memo_ent
+{
+	char			*name;
+	long			size;
+	struct timespec	atime;		// Last replayed
+}	t_memo_ent;
+
+typedef struct s_memo_scan
+{
+	t_memo_ent		*v;
+	int				n;
+	int				cap;
+	long			total;		// Bytes the whole cache holds
+}	t_memo_scan;
+
+void	memo_mix(t_memo *m, const void *data, size_t n);
+void	memo_dep(t_memo *m, char *file);
+void	memo_env(t_memo *m, char *name, char **env);
+int		memo_stdin(t_memo *m, t_shell *shell);
+int		memo_pass(t_memo *m, t_cmd *cmd, t_shell *shell);
+char	*memo_join(char *dir, char *name);
+char	*memo_dir(t_shell *shell);
+char	*memo_path(t_memo *m);
+int		memo_replay(t_memo *m);
+void	memo_store(t_memo *m, int out, int status);
+void	memo_evict(t_memo *m);
+int		memo_exec(t_memo *m, t_cmd *cmd, t_shell *shell);
+int		ft_memo(char **args, t_shell *shell);
+/* === BENCH === */
+# define BENCH_RUNS 10
+# define BENCH_CALIBRATE 200		// Empty runs timing the harness itself
+# define BENCH_FENCE 1.5			// Outliers lie this many IQRs out
+
+typedef struct s_bench
+{
+	char			*line;		// The command line as given
+	t_token			*tokens;
+	t_node			*tree;		// Parsed once, run every time
+	long			*ns;		// Wall time of each run, in run order
+	long			*sorted;	// The same times, sorted once done
+	int				done;
+	long			user;		// CPU time of all runs, shell and children
+	long			sys;
+	double			mean;
+	double			sd;
+	int				outliers;
+}	t_bench;
+
+typedef struct s_bench_set
+{
+	t_bench			*b;
+	int				n;
+	int				warmup;
+	int				runs;
+	int				compare;
+	char			*json;
+	long			overhead;	// Of the timing itself, off every run
+}	t_bench_set;
+
+int		bench_parse(char **words, t_bench_set *s, t_shell *shell);
+int		bench_free(t_bench_set *s, int status);
+int		bench_run(t_bench_set *s, t_shell *shell);
+double	bench_pct(t_bench *b, double p);
+void	bench_stats(t_bench *b);
+void	bench_time(t_buf *buf, double ns, long unit, int digits);
+void	bench_report(t_bench *b, t_bench_set *s);
+void	bench_compare(t_bench_set *s);
+int		bench_json(t_bench_set *s);
+int		ft_bench(char **args, t_shell *shell);
+int		ft_xargs(char **args, t_shell *shell);
+int		ft_local(char **args, t_shell *shell);
+int		ft_return(char **args, t_shell *shell);
+int		ft_alias(char **args, t_shell *shell);
+int		ft_unalias(char **args, t_shell *shell);
+int		meter_opts(char **args, char **name);
+int		meter_threaded(t_cmd *cmd, t_shell *shell);
+int		ft_meter(char **args);
+int		cat_is_plain(char **args);
+int		is_stream_builtin(char **args);
+int		is_pure_builtin(char **args);
+int		ft_cat(char **args);
+int		cat_fd(int in, int out);
+int		cat_files(char **files, int in, int out);
+int		alias_bad_name(char *name, size_t len);
+int		xargs_grow(t_xargs *x);
+void	xargs_drop_args(t_xargs *x);
+int		xargs_flush(t_xargs *x, t_shell *shell);
+int		xargs_push(t_xargs *x, char *arg, t_shell *shell);
+
 #endif
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_alias.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:51:08 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 13:31:47 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Appends alias name='value', the form alias takes back, with each '
+ * of the value written as '\''*/
+static int	alias_print(t_alias *al, t_buf *out)
+{
+	char	*value;
+	size_t	len;
+
+	if (buf_append(out, "alias ", 6)
+		|| buf_append(out, al->name, ft_strlen(al->name))
+		|| buf_append(out, "='", 2))
+		return (1);
+	value = al->value;
+	while (*value)
+	{
+		len = 0;
+		while (value[len] && value[len] != '\'')
+			len++;
+		if (buf_append(out, value, len)
+			|| (value[len] && buf_append(out, "'\\''", 4)))
+			return (1);
+		value += len + (value[len] != '\0');
+	}
+	return (buf_append(out, "'\n", 2));
+}
+
+static int	alias_cmp(const void *a, const void *b)
+{
+	return (ft_strcmp((*(t_alias **)a)->name, (*(t_alias **)b)->name));
+}
+
+/*Every alias, sorted by name, in one write. The table is gathered as
+ * an array of pointers in a t_buf*/
+static int	alias_list(t_shell *shell)
+{
+	t_buf	ptrs;
+	t_buf	out;
+	t_alias	*al;
+	size_t	i;
+
+	buf_init(&ptrs);
+	buf_init(&out);
+	i = 0;
+	while (i < ALIAS_TABLE_SIZE)
+	{
+		al = shell->aliases[i++];
+		while (al && buf_append(&ptrs, (char *)&al, sizeof(al)) == 0)
+			al = al->next;
+	}
+	if (ptrs.len)
+		qsort(ptrs.data, ptrs.len / sizeof(al), sizeof(al), alias_cmp);
+	i = 0;
+	while (i < ptrs.len
+		&& alias_print(*(t_alias **)(ptrs.data + i), &out) == 0)
+		i += sizeof(al);
+	write_all(STDOUT_FILENO, out.data, out.len);
+	buf_free(&ptrs);
+	buf_free(&out);
+	return (i < ptrs.len);
+}
+
+/*alias NAME=VALUE defines, alias NAME prints*/
+static int	alias_one(char *arg, t_shell *shell)
+{
+	t_alias	*al;
+	t_buf	out;
+	char	*eq;
+	int		err;
+
+	eq = ft_strchr(arg, '=');
+	if (eq == arg || (eq && alias_bad_name(arg, eq - arg)))
+		return (cmd_error("alias", arg, "invalid alias name"));
+	if (eq)
+	{
+		*eq = '\0';
+		err = alias_set(shell, arg, eq + 1);
+		*eq = '=';
+		return (err);
+	}
+	al = alias_find(shell, arg);
+	if (!al)
+		return (cmd_error("alias", arg, "not found"));
+	buf_init(&out);
+	err = alias_print(al, &out);
+	if (!err)
+		write_all(STDOUT_FILENO, out.data, out.len);
+	buf_free(&out);
+	return (err);
+}
+
+/*alias [NAME[=VALUE]...], without arguments lists them all*/
+int	ft_alias(char **args, t_shell *shell)
+{
+	int	status;
+	int	i;
+
+	if (!args[1])
+		return (alias_list(shell));
+	status = 0;
+	i = 1;
+	while (args[i])
+	{
+		if (alias_one(args[i], shell))
+			status = 1;
+		i++;
+	}
+	return (status);
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_bench.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:56:44 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 12:56:44 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*A run count: digits only, at least min*/
+static int	bench_count(char *s, int *n, int min)
+{
+	long	v;
+
+	if (!s || !*s)
+		return (1);
+	v = 0;
+	while (ft_isdigit(*s) && v <= INT_MAX)
+		v = v * 10 + (*s++ - '0');
+	if (*s || v < min || v > INT_MAX)
+		return (1);
+	*n = v;
+	return (0);
+}
+
+/*-w N, -n N, --compare, --json FILE, --. Returns the index of the first
+ * word of the command, -1 on a bad option*/
+static int	bench_opts(char **args, t_bench_set *s)
+{
+	int	i;
+
+	i = 1;
+	while (args[i] && args[i][0] == '-')
+	{
+		if (!ft_strcmp(args[i], "--"))
+			return (i + 1);
+		if (!ft_strcmp(args[i], "-w") && !bench_count(args[i + 1],
+				&s->warmup, 0))
+			i++;
+		else if (!ft_strcmp(args[i], "-n") && !bench_count(args[i + 1],
+				&s->runs, 1))
+			i++;
+		else if (!ft_strcmp(args[i], "--json") && args[i + 1])
+			s->json = args[++i];
+		else if (!ft_strcmp(args[i], "--compare"))
+			s->compare = 1;
+		else
+			return (-1);
+		i++;
+	}
+	return (i);
+}
+
+/*bench [-w WARMUP] [-n RUNS] [--json FILE] [--compare] [--] COMMAND...
+ * Parses COMMAND once and runs it WARMUP times, then RUNS more timed,
+ * with its output on /dev/null. With --compare every word is a command
+ * of its own, and the fastest is weighed against the others*/
+int	ft_bench(char **args, t_shell *shell)
+{
+	t_bench_set	s;
+	int			i;
+	int			status;
+
+	ft_bzero(&s, sizeof(t_bench_set));
+	s.runs = BENCH_RUNS;
+	i = bench_opts(args, &s);
+	if (i < 0 || !args[i])
+	{
+		ft_putstr_fd("minishell: bench: usage: bench [-w warmup] ", 2);
+		ft_putendl_fd("[-n runs] [--json file] [--compare] [--] command ...",
+			2);
+		return (2);
+	}
+	if (bench_parse(args + i, &s, shell))
+		return (bench_free(&s, 2));
+	status = bench_run(&s, shell);
+	if (!status && s.json)
+		status = bench_json(&s);
+	return (bench_free(&s, status));
+}
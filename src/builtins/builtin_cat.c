@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_cat.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:28:42 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 13:51:08 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Only operands: "-" is stdin, any other word starting with '-' is an
+ * option, left to the real cat*/
+int	cat_is_plain(char **args)
+{
+	int	i;
+
+	i = 1;
+	while (args[i])
+	{
+		if (args[i][0] == '-' && args[i][1])
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+/*Builtins reading a stream, which may well be a terminal: run alone,
+ * they still get a child, or a thread, rather than the shell itself,
+ * so that ^C stops them and not the prompt*/
+int	is_stream_builtin(char **args)
+{
+	return (is_builtin(args) && (!ft_strcmp(args[0], "cat")
+			|| !ft_strcmp(args[0], "meter")
+			|| !ft_strcmp(args[0], "xargs")));
+}
+
+/*One operand, "-" being in. Returns its status, -1 once out is gone*/
+static int	cat_one(char *name, int in, int out)
+{
+	int	fd;
+	int	ret;
+	int	err;
+
+	fd = in;
+	if (ft_strcmp(name, "-"))
+		fd = open(name, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return (cmd_error("cat", name, strerror(errno)));
+	ret = cat_fd(fd, out);
+	err = errno;
+	if (ret == 2)
+		cmd_error("cat", name, "input file is output file");
+	else if (ret && err != EPIPE)
+		cmd_error("cat", name, strerror(err));
+	if (fd != in)
+		close(fd);
+	if (ret && err == EPIPE)
+		return (-1);
+	return (ret != 0);
+}
+
+/*cat's operands in order, none meaning in. One that fails is reported
+ * and passed over, a reader gone ends it. Returns the status*/
+int	cat_files(char **files, int in, int out)
+{
+	int	status;
+	int	ret;
+	int	i;
+
+	if (!files[0])
+		return (cat_one("-", in, out) != 0);
+	status = 0;
+	i = 0;
+	while (files[i])
+	{
+		ret = cat_one(files[i++], in, out);
+		if (ret < 0)
+			return (1);
+		if (ret)
+			status = 1;
+	}
+	return (status);
+}
+
+/*cat [FILE...]: each FILE, stdin for none or "-", to stdout. The copy
+ * stays in the kernel where the pair allows it, see cat_fd*/
+int	ft_cat(char **args)
+{
+	return (cat_files(args + 1, STDIN_FILENO, STDOUT_FILENO));
+}
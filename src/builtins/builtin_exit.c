@@ -6,7 +6,7 @@
 /*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/27 14:42:40 by abroslav          #+#    #+#             */
-/*   Updated: 2026/01/29 14:47:10 by abroslav         ###   ########.fr       */
+/*   Updated: 2026/10/19 13:14:11 by abroslav         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -26,7 +26,8 @@ int	ft_exit(char **args, t_shell *shell)
 	long long	res;
 	int			i;
 
-	ft_putendl_fd("exit", 1);
+	if (isatty(STDIN_FILENO))
+		ft_putendl_fd("exit", 2);
 	i = 1;
 	if (args[i] && ft_strcmp(args[i], "--") == 0)
 		i++;
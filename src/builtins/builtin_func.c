@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_func.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:47:58 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 11:47:58 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static int	local_one(char *arg, t_shell *shell)
+{
+	char	*unset_args[3];
+	char	*name;
+	int		len;
+
+	len = 0;
+	while (arg[len] && arg[len] != '=' && arg[len] != '+')
+		len++;
+	name = ft_substr(arg, 0, len);
+	if (!name || frame_save_local(shell->frame, name, shell))
+		return (free(name), 1);
+	if (arg[len])
+		update_env(arg, &shell->env_vars);
+	else
+	{
+		unset_args[0] = "unset";
+		unset_args[1] = name;
+		unset_args[2] = NULL;
+		ft_unset(unset_args, &shell->env_vars);
+	}
+	free(name);
+	return (0);
+}
+
+/*local NAME[=VALUE]...: the variables are put back as they were once
+ * the function returns. Without a value a variable starts out unset*/
+int	ft_local(char **args, t_shell *shell)
+{
+	int	status;
+	int	i;
+
+	if (!shell->frame)
+	{
+		ft_putendl_fd("minishell: local: can only be used in a function", 2);
+		return (1);
+	}
+	status = 0;
+	i = 1;
+	while (args[i])
+	{
+		if (!is_valid_key(args[i]))
+		{
+			ft_putstr_fd("minishell: local: `", 2);
+			ft_putstr_fd(args[i], 2);
+			ft_putendl_fd("': not a valid identifier", 2);
+			status = 1;
+		}
+		else if (local_one(args[i], shell))
+			status = 1;
+		i++;
+	}
+	return (status);
+}
+
+/*return [N]: ends the function call, with $? as N or left as it is.
+ * The lists being run stop, see exec_stopped()*/
+int	ft_return(char **args, t_shell *shell)
+{
+	long long	res;
+
+	if (!shell->frame)
+	{
+		ft_putendl_fd("minishell: return: can only `return' from a function",
+			2);
+		return (1);
+	}
+	shell->returning = 1;
+	if (!args[1])
+		return (shell->exit_code);
+	if (ft_atoll_overflow(args[1], &res))
+	{
+		ft_putstr_fd("minishell: return: ", 2);
+		ft_putstr_fd(args[1], 2);
+		ft_putendl_fd(": numeric argument required", 2);
+		return (2);
+	}
+	return ((unsigned char)res);
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_memo.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:07 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 13:52:08 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*--ttl DURATION, --env NAME, --dep FILE... up to the next option, --.
+ * Returns the index of the command, -1 on a bad option*/
+static int	memo_opts(char **args, t_memo *m, t_shell *shell)
+{
+	int	i;
+
+	i = 1;
+	while (args[i] && args[i][0] == '-')
+	{
+		if (!ft_strcmp(args[i], "--"))
+			return (i + 1);
+		if (!ft_strcmp(args[i], "--ttl") && args[i + 1]
+			&& !timeout_duration(args[i + 1], &m->ttl))
+			i++;
+		else if (!ft_strcmp(args[i], "--env") && args[i + 1])
+			memo_env(m, args[++i], shell->env_vars);
+		else if (!ft_strcmp(args[i], "--dep") && args[i + 1]
+			&& args[i + 1][0] != '-')
+			while (args[i + 1] && args[i + 1][0] != '-')
+				memo_dep(m, args[++i]);
+		else
+			return (-1);
+		i++;
+	}
+	return (i);
+}
+
+/*MINISHELL_MEMO_MAX and MINISHELL_MEMO_SIZE, in bytes, K or M*/
+static long	memo_limit(t_shell *shell, char *key, long fallback)
+{
+	long	n;
+
+	n = pipe_size_parse(get_env_value(shell->env_vars, key));
+	if (n < 0)
+		return (fallback);
+	return (n);
+}
+
+/*The key starts from PATH, the options and the directory the command
+ * runs in, then takes its words. Returns the index of the command*/
+static int	memo_key(t_memo *m, char **args, t_shell *shell)
+{
+	char	*cwd;
+	int		i;
+	int		j;
+
+	m->a = MEMO_FNV_BASIS;
+	m->b = MEMO_MIX;
+	m->in = -1;
+	m->max = memo_limit(shell, "MINISHELL_MEMO_MAX", MEMO_MAX_DEFAULT);
+	m->size = memo_limit(shell, "MINISHELL_MEMO_SIZE", MEMO_SIZE_DEFAULT);
+	m->dir = memo_dir(shell);
+	memo_env(m, "PATH", shell->env_vars);
+	i = memo_opts(args, m, shell);
+	if (i < 0 || !args[i])
+		return (-1);
+	cwd = getcwd(NULL, 0);
+	if (cwd)
+		memo_mix(m, cwd, ft_strlen(cwd));
+	free(cwd);
+	j = i;
+	while (args[j])
+	{
+		memo_mix(m, args[j], ft_strlen(args[j]));
+		j++;
+	}
+	return (i);
+}
+
+static int	memo_free(t_memo *m, int status)
+{
+	if (m->in >= 0)
+		close(m->in);
+	free(m->dir);
+	free(m->path);
+	return (status);
+}
+
+/*memo [--ttl DURATION] [--env NAME] [--dep FILE...] [--] COMMAND [ARG]...
+ * Replays COMMAND's stdout and status from the cache when it already ran
+ * with the same words, PATH and named variables, directory, stdin and
+ * dependencies, else runs it and keeps them. Runs it uncached when the
+ * cache cannot be used, or stdin is more than MINISHELL_MEMO_MAX*/
+int	ft_memo(char **args, t_shell *shell)
+{
+	t_memo	m;
+	t_cmd	cmd;
+	int		status;
+
+	ft_bzero(&m, sizeof(t_memo));
+	status = memo_key(&m, args, shell);
+	if (status < 0)
+	{
+		ft_putstr_fd("minishell: memo: usage: memo [--ttl duration] ", 2);
+		ft_putendl_fd("[--env name] [--dep file ...] [--] command ...", 2);
+		return (2);
+	}
+	ft_bzero(&cmd, sizeof(t_cmd));
+	cmd.args = args + status;
+	cmd.heredoc_fd = -1;
+	cmd.tee_fd = -1;
+	if (memo_stdin(&m, shell))
+		return (perror("minishell: memo"), memo_free(&m, 1));
+	if (m.over)
+		return (memo_free(&m, memo_pass(&m, &cmd, shell)));
+	m.path = memo_path(&m);
+	status = memo_replay(&m);
+	if (status < 0)
+		status = memo_exec(&m, &cmd, shell);
+	return (memo_free(&m, status));
+}
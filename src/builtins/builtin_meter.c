@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_meter.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:23:12 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:43:32 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*[-n NAME] [--], nothing else. Returns 1 on anything else; *name is
+ * NAME, allocated, or NULL*/
+int	meter_opts(char **args, char **name)
+{
+	int	i;
+
+	*name = NULL;
+	i = 1;
+	if (args[i] && !ft_strcmp(args[i], "-n") && args[i + 1])
+	{
+		*name = ft_strdup(args[i + 1]);
+		if (!*name)
+			return (1);
+		i += 2;
+	}
+	if (args[i] && !ft_strcmp(args[i], "--"))
+		i++;
+	if (!args[i])
+		return (0);
+	free(*name);
+	*name = NULL;
+	return (1);
+}
+
+/*A plain meter or cat stage with valid options runs as a thread of the
+ * shell: no redirections to apply, no function of that name hiding it*/
+int	meter_threaded(t_cmd *cmd, t_shell *shell)
+{
+	char	*name;
+
+	if (!cmd->args || !cmd->args[0] || cmd->body || cmd->redirs
+		|| func_find(shell, cmd->args[0]))
+		return (0);
+	if (!ft_strcmp(cmd->args[0], "cat"))
+		return (cat_is_plain(cmd->args));
+	if (ft_strcmp(cmd->args[0], "meter") || meter_opts(cmd->args, &name))
+		return (0);
+	free(name);
+	return (1);
+}
+
+
+/*meter [-n NAME]: copies stdin to stdout, reporting how much and how
+ * fast on stderr. Inside a pipeline it is a thread of the shell, see
+ * meter_start; this runs it alone or with redirections*/
+int	ft_meter(char **args)
+{
+	t_meter			m;
+	sigset_t		set;
+	sigset_t		old;
+	struct timespec	zero;
+
+	ft_bzero(&m, sizeof(t_meter));
+	if (meter_opts(args, &m.name))
+	{
+		ft_putendl_fd("minishell: meter: usage: meter [-n name]", 2);
+		return (2);
+	}
+	m.out = STDOUT_FILENO;
+	sigemptyset(&set);
+	sigaddset(&set, SIGPIPE);
+	sigprocmask(SIG_BLOCK, &set, &old);
+	m.status = meter_copy(&m);
+	ft_bzero(&zero, sizeof(zero));
+	sigtimedwait(&set, NULL, &zero);
+	sigprocmask(SIG_SETMASK, &old, NULL);
+	free(m.name);
+	return (m.status);
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_timeout.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:46:11 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:46:11 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*TERM, SIGTERM or 15. Returns 0 for no such signal*/
+static int	timeout_signal(char *s)
+{
+	char	*names;
+	size_t	len;
+	int		n;
+
+	if (!ft_strncmp(s, "SIG", 3))
+		s += 3;
+	if (ft_isdigit(*s) && ft_atoi(s) > 0 && ft_atoi(s) < NSIG)
+		return (ft_atoi(s));
+	names = "HUP INT QUIT ILL TRAP ABRT BUS FPE KILL USR1 SEGV USR2 "
+		"PIPE ALRM TERM";
+	len = ft_strlen(s);
+	n = 1;
+	while (len && *names)
+	{
+		if (!ft_strncmp(names, s, len) && (!names[len] || names[len] == ' '))
+			return (n);
+		while (*names && *names != ' ')
+			names++;
+		names += (*names == ' ');
+		n++;
+	}
+	return (0);
+}
+
+/*Seconds in one of the suffix's units: none or s, m, h or d*/
+static long	timeout_unit(char *s)
+{
+	if (!*s || (*s == 's' && !s[1]))
+		return (1);
+	if (s[1])
+		return (0);
+	if (*s == 'm')
+		return (60);
+	if (*s == 'h')
+		return (3600);
+	if (*s == 'd')
+		return (86400);
+	return (0);
+}
+
+/*A duration like coreutils takes it: 10, 1.5, 2m or .5h.
+ * Returns 1 if s is none*/
+int	timeout_duration(char *s, struct timespec *ts)
+{
+	long	sec;
+	long	ns;
+	long	scale;
+	long	unit;
+
+	sec = 0;
+	ns = 0;
+	scale = 100000000;
+	if (!ft_isdigit(*s) && !(*s == '.' && ft_isdigit(s[1])))
+		return (1);
+	while (ft_isdigit(*s) && sec < 1000000000000)
+		sec = sec * 10 + *s++ - '0';
+	s += (*s == '.');
+	while (ft_isdigit(*s))
+	{
+		ns += (*s++ - '0') * scale;
+		scale /= 10;
+	}
+	unit = timeout_unit(s);
+	if (!unit)
+		return (1);
+	ts->tv_sec = sec * unit + ns * unit / 1000000000;
+	ts->tv_nsec = ns * unit % 1000000000;
+	return (0);
+}
+
+/*-s SIG, -k DURATION, --. Returns the index of DURATION, -1 on a bad
+ * option*/
+static int	timeout_opts(char **args, t_timeout *t)
+{
+	int	i;
+
+	i = 1;
+	while (args[i] && args[i][0] == '-' && args[i][1])
+	{
+		if (!ft_strcmp(args[i], "--"))
+			return (i + 1);
+		if (!ft_strcmp(args[i], "-s") && args[i + 1])
+			t->sig = timeout_signal(args[++i]);
+		else if (!ft_strcmp(args[i], "-k") && args[i + 1]
+			&& !timeout_duration(args[i + 1], &t->kill_after))
+			i++;
+		else
+			return (-1);
+		if (!t->sig)
+			return (-1);
+		i++;
+	}
+	return (i);
+}
+
+/*timeout [-s SIG] [-k KILLAFTER] DURATION COMMAND [ARG]...
+ * Sends SIG, TERM by default, to the whole of COMMAND once DURATION is
+ * up, and KILL KILLAFTER later if it still runs. 124 when time ran out,
+ * 125 when timeout itself failed, else the command's status*/
+int	ft_timeout(char **args, t_shell *shell)
+{
+	t_timeout	t;
+	t_cmd		cmd;
+	int			i;
+
+	ft_bzero(&t, sizeof(t_timeout));
+	t.sig = SIGTERM;
+	i = timeout_opts(args, &t);
+	if (i < 0 || !args[i] || !args[i + 1]
+		|| timeout_duration(args[i], &t.limit))
+	{
+		ft_putstr_fd("minishell: timeout: usage: timeout [-s sig] ", 2);
+		ft_putendl_fd("[-k duration] duration command [arg ...]", 2);
+		return (TIMEOUT_FAIL);
+	}
+	ft_bzero(&cmd, sizeof(t_cmd));
+	cmd.args = args + i + 1;
+	cmd.heredoc_fd = -1;
+	cmd.tee_fd = -1;
+	return (timeout_run(&t, &cmd, shell));
+}
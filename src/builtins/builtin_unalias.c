@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_unalias.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:51:08 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 13:31:47 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*An alias name holding quotes, blanks, / $ or an operator could never
+ * be typed as the word it replaces*/
+int	alias_bad_name(char *name, size_t len)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < len)
+	{
+		if (ft_strchr("/$`'\"\\ \t\n|&;<>()", name[i]))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/*unalias -a | NAME...*/
+int	ft_unalias(char **args, t_shell *shell)
+{
+	int	status;
+	int	i;
+
+	if (!args[1])
+	{
+		ft_putendl_fd("minishell: unalias: usage: unalias [-a] name ...", 2);
+		return (2);
+	}
+	if (!ft_strcmp(args[1], "-a"))
+	{
+		alias_clear(shell);
+		return (0);
+	}
+	status = 0;
+	i = 1;
+	while (args[i])
+	{
+		if (alias_remove(shell, args[i]))
+			status = cmd_error("unalias", args[i], "not found");
+		i++;
+	}
+	return (status);
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_xargs.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:51:27 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 13:13:10 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Parses -0, -r and -n N. Returns the index of the first command word
+ * or -1 on a bad option*/
+static int	xargs_options(t_xargs *x, char **args)
+{
+	int	i;
+
+	i = 1;
+	while (args[i] && args[i][0] == '-' && args[i][1])
+	{
+		if (!ft_strcmp(args[i], "--"))
+			return (i + 1);
+		if (!ft_strcmp(args[i], "-0"))
+			x->nul_mode = 1;
+		else if (!ft_strcmp(args[i], "-r"))
+			x->no_run_empty = 1;
+		else if (!ft_strcmp(args[i], "-n") && args[i + 1]
+			&& ft_atoi(args[i + 1]) > 0)
+			x->max_args = ft_atoi(args[++i]);
+		else
+		{
+			ft_putstr_fd("minishell: xargs: usage: xargs [-0] [-r] ", 2);
+			ft_putendl_fd("[-n max] [command [args...]]", 2);
+			return (-1);
+		}
+		i++;
+	}
+	return (i);
+}
+
+/*The command prefix is borrowed from args, only input args are owned.
+ * Without a command, xargs runs echo like coreutils does*/
+static int	xargs_init(t_xargs *x, char **args, char **env)
+{
+	static char	*def_cmd[] = {"echo", NULL};
+	char		**words;
+	int			first;
+
+	ft_bzero(x, sizeof(t_xargs));
+	first = xargs_options(x, args);
+	if (first < 0)
+		return (1);
+	words = args + first;
+	if (!*words)
+		words = def_cmd;
+	while (words[x->count])
+	{
+		if (xargs_grow(x))
+			return (free(x->argv), 1);
+		x->argv[x->count] = words[x->count];
+		x->base += ft_strlen(x->argv[x->count++]) + 1 + sizeof(char *);
+	}
+	x->prefix = x->count;
+	x->used = x->base;
+	x->limit = exec_arg_budget(env);
+	return (0);
+}
+
+/*Next input argument, NULL at end of input. Blank separated by default,
+ * '\0' terminated with -0 (where empty arguments are kept)*/
+static char	*xargs_next_arg(t_reader *rd, int nul_mode)
+{
+	t_buf	tok;
+	char	ch;
+	int		c;
+
+	buf_init(&tok);
+	c = reader_getc(rd);
+	while (!nul_mode && c >= 0 && ft_isspace(c))
+		c = reader_getc(rd);
+	if (c < 0)
+		return (NULL);
+	while (c >= 0 && !(nul_mode && c == '\0')
+		&& !(!nul_mode && ft_isspace(c)))
+	{
+		ch = (char)c;
+		if (buf_append(&tok, &ch, 1))
+			return (buf_free(&tok), NULL);
+		c = reader_getc(rd);
+	}
+	return (buf_release(&tok));
+}
+
+/*Swaps /dev/null in for stdin and returns the input, moved to another
+ * fd, so that a batch reading stdin cannot eat the words not yet read.
+ * Given that fd back, puts it back on stdin*/
+static int	xargs_stdin(int in)
+{
+	int	fd;
+
+	if (in >= 0)
+	{
+		dup2(in, STDIN_FILENO);
+		close(in);
+		return (-1);
+	}
+	in = fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC, 0);
+	fd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+	if (in < 0 || fd < 0 || dup2(fd, STDIN_FILENO) < 0)
+		return (close(fd), close(in), perror("minishell: xargs"), -1);
+	close(fd);
+	return (in);
+}
+
+/*In-process xargs: input is read through a block reader and packed
+ * into argv batches sized for execve(). Builtin targets run without
+ * forking, everything else goes through the normal spawn path. Every
+ * batch gets /dev/null as stdin, as with GNU xargs*/
+int	ft_xargs(char **args, t_shell *shell)
+{
+	t_xargs		x;
+	t_reader	rd;
+	char		*arg;
+	int			stop;
+
+	if (xargs_init(&x, args, shell->env_vars))
+		return (1);
+	stop = xargs_stdin(-1);
+	if (stop < 0)
+		return (free(x.argv), 1);
+	reader_init(&rd, stop);
+	stop = 0;
+	arg = xargs_next_arg(&rd, x.nul_mode);
+	while (arg && !stop)
+	{
+		stop = xargs_push(&x, arg, shell);
+		if (!stop)
+			arg = xargs_next_arg(&rd, x.nul_mode);
+	}
+	if (!stop && (x.count > x.prefix || (!x.ran && !x.no_run_empty)))
+		xargs_flush(&x, shell);
+	xargs_drop_args(&x);
+	free(x.argv);
+	xargs_stdin(rd.fd);
+	return (x.status);
+}
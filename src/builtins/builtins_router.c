@@ -6,7 +6,7 @@
 /*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/27 14:47:16 by abroslav          #+#    #+#             */
-/*   Updated: 2026/01/31 17:37:46 by fshiniti         ###   ########.fr       */
+/*   Updated: 2026/10/19 13:50:42 by fshiniti         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,21 +16,43 @@ int	is_builtin(char **args)
 {
 	if (!args || !args[0])
 		return (0);
-	if (!ft_strncmp(args[0], "echo", 5))
-		return (1);
-	if (!ft_strncmp(args[0], "pwd", 4))
-		return (1);
 	if (!ft_strncmp(args[0], "env", 4))
 		return (args[1] == NULL);
-	if (!ft_strncmp(args[0], "exit", 5))
-		return (1);
-	if (!ft_strncmp(args[0], "cd", 3))
-		return (1);
-	if (!ft_strncmp(args[0], "export", 7))
-		return (1);
-	if (!ft_strncmp(args[0], "unset", 6))
-		return (1);
-	return (0);
+	if (!ft_strncmp(args[0], "cat", 4))
+		return (cat_is_plain(args));
+	return (!ft_strncmp(args[0], "echo", 5) || !ft_strncmp(args[0], "pwd", 4)
+		|| !ft_strncmp(args[0], "exit", 5) || !ft_strncmp(args[0], "cd", 3)
+		|| !ft_strncmp(args[0], "export", 7)
+		|| !ft_strncmp(args[0], "unset", 6)
+		|| !ft_strncmp(args[0], "xargs", 6)
+		|| !ft_strncmp(args[0], "local", 6)
+		|| !ft_strncmp(args[0], "return", 7)
+		|| !ft_strncmp(args[0], "alias", 6)
+		|| !ft_strncmp(args[0], "unalias", 8)
+		|| !ft_strncmp(args[0], "meter", 6)
+		|| !ft_strncmp(args[0], "timeout", 8)
+		|| !ft_strncmp(args[0], "memo", 5)
+		|| !ft_strncmp(args[0], "bench", 6));
+}
+
+/*Builtins working on the shell itself, not only on its environment*/
+static int	exec_shell_builtin(char **args, t_shell *shell)
+{
+	if (!ft_strncmp(args[0], "xargs", 6))
+		return (ft_xargs(args, shell));
+	if (!ft_strncmp(args[0], "local", 6))
+		return (ft_local(args, shell));
+	if (!ft_strncmp(args[0], "return", 7))
+		return (ft_return(args, shell));
+	if (!ft_strncmp(args[0], "alias", 6))
+		return (ft_alias(args, shell));
+	if (!ft_strncmp(args[0], "timeout", 8))
+		return (ft_timeout(args, shell));
+	if (!ft_strncmp(args[0], "memo", 5))
+		return (ft_memo(args, shell));
+	if (!ft_strncmp(args[0], "bench", 6))
+		return (ft_bench(args, shell));
+	return (ft_unalias(args, shell));
 }
 
 int	exec_builtin(t_cmd *cmd, t_shell *shell)
@@ -38,7 +60,7 @@ int	exec_builtin(t_cmd *cmd, t_shell *shell)
 	char	**args;
 
 	args = cmd->args;
-	if (!args || !args[0])
+	if (!is_builtin(args))
 		return (0);
 	if (!ft_strncmp(args[0], "echo", 5))
 		return (ft_echo(args));
@@ -54,5 +76,20 @@ int	exec_builtin(t_cmd *cmd, t_shell *shell)
 		return (ft_export(args, &shell->env_vars));
 	if (!ft_strncmp(args[0], "unset", 6))
 		return (ft_unset(args, &shell->env_vars));
-	return (0);
+	if (!ft_strncmp(args[0], "cat", 4))
+		return (ft_cat(args));
+	if (!ft_strncmp(args[0], "meter", 6))
+		return (ft_meter(args));
+	return (exec_shell_builtin(args, shell));
+}
+
+/*Builtins whose only effect is their output. xargs and memo run these
+ * in the shell; exit, cd, export and the like would change the shell
+ * itself, so they get a child like any other command*/
+int	is_pure_builtin(char **args)
+{
+	if (!is_builtin(args))
+		return (0);
+	return (!ft_strcmp(args[0], "echo") || !ft_strcmp(args[0], "pwd")
+		|| !ft_strcmp(args[0], "env") || !ft_strcmp(args[0], "cat"));
 }
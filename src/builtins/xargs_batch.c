@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   xargs_batch.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:51:27 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:20:33 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Makes sure there is room for one more word plus the NULL terminator*/
+int	xargs_grow(t_xargs *x)
+{
+	char	**new_argv;
+	int		new_cap;
+
+	if (x->count + 2 <= x->cap)
+		return (0);
+	new_cap = x->cap * 2;
+	if (new_cap < XARGS_MIN_SLOTS)
+		new_cap = XARGS_MIN_SLOTS;
+	new_argv = malloc(sizeof(char *) * new_cap);
+	if (!new_argv)
+		return (1);
+	if (x->argv)
+		ft_memcpy(new_argv, x->argv, sizeof(char *) * x->count);
+	free(x->argv);
+	x->argv = new_argv;
+	x->cap = new_cap;
+	return (0);
+}
+
+void	xargs_drop_args(t_xargs *x)
+{
+	while (x->count > x->prefix)
+		free(x->argv[--x->count]);
+	x->used = x->base;
+}
+
+/*Runs the current batch and folds its status into the xargs result:
+ * 123 if any run failed, 124/125/126/127 stop processing (coreutils)*/
+int	xargs_flush(t_xargs *x, t_shell *shell)
+{
+	t_cmd	cmd;
+	int		code;
+
+	x->argv[x->count] = NULL;
+	ft_bzero(&cmd, sizeof(t_cmd));
+	cmd.args = x->argv;
+	cmd.heredoc_fd = -1;
+	cmd.tee_fd = -1;
+	code = run_cmd_sync(&cmd, shell);
+	x->ran = 1;
+	xargs_drop_args(x);
+	if (code >= 1 && code <= 125)
+		x->status = 123;
+	else if (code == 126 || code == 127)
+		x->status = code;
+	else if (code == 255)
+		x->status = 124;
+	else if (code > 128)
+		x->status = 125;
+	return (code > 125);
+}
+
+static int	xargs_too_long(t_xargs *x, char *arg)
+{
+	ft_putendl_fd("minishell: xargs: argument line too long", 2);
+	free(arg);
+	x->status = 1;
+	return (1);
+}
+
+/*Appends an input argument, flushing the batch first when it would go
+ * over the byte budget or the -n limit. Returns 1 to stop reading*/
+int	xargs_push(t_xargs *x, char *arg, t_shell *shell)
+{
+	long	cost;
+
+	cost = ft_strlen(arg) + 1 + sizeof(char *);
+	if (x->base + cost > x->limit || cost > EXEC_ARG_STRLEN_MAX)
+		return (xargs_too_long(x, arg));
+	if (x->count > x->prefix && (x->used + cost > x->limit
+			|| (x->max_args && x->count - x->prefix >= x->max_args)))
+	{
+		if (xargs_flush(x, shell))
+			return (free(arg), 1);
+	}
+	if (xargs_grow(x))
+		return (free(arg), 1);
+	x->argv[x->count++] = arg;
+	x->used += cost;
+	return (0);
+}
@@ -6,7 +6,7 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/28 20:36:18 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/01/27 15:30:41 by abroslav         ###   ########.fr       */
+/*   Updated: 2026/10/19 10:57:32 by abroslav         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -43,3 +43,12 @@ char	*get_env_value(char **env, char *key)
 	}
 	return (NULL);
 }
+
+/*Shell switches: on when the variable is set to anything but "" or "0"*/
+int	env_flag(char **env, char *key)
+{
+	char	*value;
+
+	value = get_env_value(env, key);
+	return (value && *value && ft_strcmp(value, "0") != 0);
+}
@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arg_max.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:18:07 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 11:18:07 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Budget for one execve(): ARG_MAX minus what the environment already
+ * takes (strings + pointers), minus some headroom for auxv and padding*/
+long	exec_arg_budget(char **env)
+{
+	long	limit;
+	int		i;
+
+	limit = sysconf(_SC_ARG_MAX);
+	if (limit <= 0)
+		limit = EXEC_ARG_MAX_DEFAULT;
+	i = 0;
+	while (env && env[i])
+		limit -= ft_strlen(env[i++]) + 1 + sizeof(char *);
+	return (limit - EXEC_ARG_HEADROOM);
+}
+
+/*Whether execve() would fail with E2BIG. Checked up front so a huge
+ * brace or glob expansion names the command in the error*/
+int	args_exceed_arg_max(char **args, char **env)
+{
+	long	budget;
+	size_t	len;
+	int		i;
+
+	budget = exec_arg_budget(env);
+	i = 0;
+	while (args[i] && budget >= 0)
+	{
+		len = ft_strlen(args[i++]);
+		if (len >= EXEC_ARG_STRLEN_MAX)
+			return (1);
+		budget -= len + 1 + sizeof(char *);
+	}
+	return (budget < 0);
+}
@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:56:44 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:33:11 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*User and system time of the shell and every child it reaped, in ns.
+ * The executor does the waiting, so this stands in for wait4*/
+static void	bench_cpu(long *cpu)
+{
+	struct rusage	self;
+	struct rusage	kids;
+
+	getrusage(RUSAGE_SELF, &self);
+	getrusage(RUSAGE_CHILDREN, &kids);
+	cpu[0] = (self.ru_utime.tv_sec + kids.ru_utime.tv_sec) * 1000000000L
+		+ (self.ru_utime.tv_usec + kids.ru_utime.tv_usec) * 1000L;
+	cpu[1] = (self.ru_stime.tv_sec + kids.ru_stime.tv_sec) * 1000000000L
+		+ (self.ru_stime.tv_usec + kids.ru_stime.tv_usec) * 1000L;
+}
+
+/*One run of the tree, timed. Returns its status*/
+static int	bench_once(t_bench *b, t_shell *shell, long overhead, long *ns)
+{
+	struct timespec	t[2];
+	long			cpu[4];
+
+	bench_cpu(cpu);
+	clock_gettime(CLOCK_MONOTONIC, &t[0]);
+	exec_tree(b->tree, shell);
+	clock_gettime(CLOCK_MONOTONIC, &t[1]);
+	bench_cpu(cpu + 2);
+	*ns = (t[1].tv_sec - t[0].tv_sec) * 1000000000L
+		+ t[1].tv_nsec - t[0].tv_nsec - overhead;
+	if (*ns < 0)
+		*ns = 0;
+	b->user += cpu[2] - cpu[0];
+	b->sys += cpu[3] - cpu[1];
+	return (shell->exit_code);
+}
+
+/*The cheapest of many runs of an empty { } group. It goes through
+ * exec_tree and the executor like any command in the shell, so what is
+ * taken off each run is the harness and the dispatch, not the timer*/
+static long	bench_overhead(t_shell *shell)
+{
+	t_bench	noop;
+	t_node	node[2];
+	t_cmd	cmd;
+	long	best;
+	long	ns;
+
+	ft_bzero(&noop, sizeof(t_bench));
+	ft_bzero(node, sizeof(node));
+	ft_bzero(&cmd, sizeof(t_cmd));
+	node[0].type = ND_PIPELINE;
+	node[0].cmds = &cmd;
+	node[1].type = ND_GROUP;
+	cmd.body = &node[1];
+	cmd.heredoc_fd = -1;
+	cmd.tee_fd = -1;
+	noop.tree = node;
+	best = -1;
+	while (noop.done++ < BENCH_CALIBRATE)
+	{
+		bench_once(&noop, shell, 0, &ns);
+		if (best < 0 || ns < best)
+			best = ns;
+	}
+	return (best);
+}
+
+/*Warmup runs, then the timed ones. Stops at the first failing run*/
+static int	bench_loop(t_bench *b, t_bench_set *s, t_shell *shell)
+{
+	long	ns;
+	int		status;
+	int		i;
+
+	i = 0;
+	status = 0;
+	while (!status && i++ < s->warmup && !exec_stopped(shell))
+		status = bench_once(b, shell, s->overhead, &ns);
+	b->user = 0;
+	b->sys = 0;
+	while (!status && b->done < s->runs && !exec_stopped(shell))
+		status = bench_once(b, shell, s->overhead, &b->ns[b->done++]);
+	if (exec_stopped(shell))
+		return (130);
+	if (status)
+	{
+		ft_putstr_fd("minishell: bench: ", 2);
+		ft_putstr_fd(b->line, 2);
+		ft_putstr_fd(": exited with ", 2);
+		ft_putnbr_fd(status, 2);
+		ft_putchar_fd('\n', 2);
+	}
+	return (status);
+}
+
+/*Runs every command with its output on /dev/null, then reports them.
+ * Returns the status of the first failing run, 0 if none failed*/
+int	bench_run(t_bench_set *s, t_shell *shell)
+{
+	int	saved;
+	int	null;
+	int	status;
+	int	i;
+
+	saved = dup(STDOUT_FILENO);
+	null = open("/dev/null", O_WRONLY | O_CLOEXEC);
+	if (saved < 0 || null < 0 || dup2(null, STDOUT_FILENO) < 0)
+		return (close(saved), close(null), perror("minishell: bench"), 1);
+	close(null);
+	s->overhead = bench_overhead(shell);
+	status = 0;
+	i = 0;
+	while (!status && i < s->n)
+		status = bench_loop(&s->b[i++], s, shell);
+	dup2(saved, STDOUT_FILENO);
+	close(saved);
+	i = 0;
+	while (!status && i < s->n)
+		bench_report(&s->b[i++], s);
+	if (!status && s->compare && s->n > 1)
+		bench_compare(s);
+	return (status);
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_fmt.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:56:44 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:33:11 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*ns in units of unit, rounded to digits decimals*/
+void	bench_time(t_buf *buf, double ns, long unit, int digits)
+{
+	long	scale;
+	long	v;
+	int		i;
+
+	scale = 1;
+	i = 0;
+	while (i++ < digits)
+		scale *= 10;
+	if (ns < 0)
+		ns = 0;
+	v = (long)(ns * scale / unit + 0.5);
+	meter_num(buf, v / scale, 0);
+	if (!digits)
+		return ;
+	buf_append(buf, ".", 1);
+	meter_num(buf, v % scale, digits);
+}
+
+/*label then ns, in seconds, milliseconds or microseconds, whichever
+ * suits the mean of its command*/
+static void	bench_field(t_buf *buf, char *label, double ns, double mean)
+{
+	char	*name;
+	long	unit;
+
+	name = " us";
+	unit = 1000L;
+	if (mean >= 1e9)
+		unit = 1000000000L;
+	else if (mean >= 1e6)
+		unit = 1000000L;
+	if (unit == 1000000000L)
+		name = " s";
+	else if (unit == 1000000L)
+		name = " ms";
+	buf_append(buf, label, ft_strlen(label));
+	bench_time(buf, ns, unit, 3);
+	buf_append(buf, name, ft_strlen(name));
+}
+
+/*Wall time statistics, then CPU time per run, in one write*/
+void	bench_report(t_bench *b, t_bench_set *s)
+{
+	t_buf	buf;
+
+	bench_stats(b);
+	buf_init(&buf);
+	buf_append(&buf, "bench: ", 7);
+	buf_append(&buf, b->line, ft_strlen(b->line));
+	bench_field(&buf, "\n  mean ", b->mean, b->mean);
+	bench_field(&buf, " +- ", b->sd, b->mean);
+	bench_field(&buf, "   user ", (double)b->user / b->done, b->mean);
+	bench_field(&buf, "   sys ", (double)b->sys / b->done, b->mean);
+	bench_field(&buf, "\n  min ", b->sorted[0], b->mean);
+	bench_field(&buf, "   median ", bench_pct(b, 0.5), b->mean);
+	bench_field(&buf, "   p95 ", bench_pct(b, 0.95), b->mean);
+	bench_field(&buf, "   p99 ", bench_pct(b, 0.99), b->mean);
+	bench_field(&buf, "   max ", b->sorted[b->done - 1], b->mean);
+	buf_append(&buf, "\n  ", 3);
+	meter_num(&buf, b->done, 0);
+	buf_append(&buf, " runs, ", 7);
+	meter_num(&buf, b->outliers, 0);
+	buf_append(&buf, " outliers, harness of ", 22);
+	meter_num(&buf, s->overhead, 0);
+	buf_append(&buf, " ns taken off each run\n", 23);
+	if (buf.data)
+		write_all(STDOUT_FILENO, buf.data, buf.len);
+	buf_free(&buf);
+}
+
+/*  1.52 +- 0.03 times faster than b, the error propagated from both
+ * standard deviations*/
+static void	bench_ratio(t_buf *buf, t_bench *b, t_bench *fastest)
+{
+	double	r;
+
+	r = b->mean / fastest->mean;
+	buf_append(buf, "  ", 2);
+	bench_time(buf, r, 1, 2);
+	buf_append(buf, " +- ", 4);
+	bench_time(buf, r * hypot(fastest->sd / fastest->mean, b->sd / b->mean),
+		1, 2);
+	buf_append(buf, " times faster than ", 19);
+	buf_append(buf, b->line, ft_strlen(b->line));
+	buf_append(buf, "\n", 1);
+}
+
+void	bench_compare(t_bench_set *s)
+{
+	t_buf	buf;
+	t_bench	*f;
+	int		i;
+
+	f = s->b;
+	i = 0;
+	while (++i < s->n)
+		if (s->b[i].mean < f->mean)
+			f = &s->b[i];
+	buf_init(&buf);
+	buf_append(&buf, "bench: ", 7);
+	buf_append(&buf, f->line, ft_strlen(f->line));
+	buf_append(&buf, " ran\n", 5);
+	i = -1;
+	while (++i < s->n && f->mean > 0)
+		if (&s->b[i] != f)
+			bench_ratio(&buf, &s->b[i], f);
+	if (buf.data)
+		write_all(STDOUT_FILENO, buf.data, buf.len);
+	buf_free(&buf);
+}
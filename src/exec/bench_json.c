@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_json.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:56:44 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:33:11 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*s as a JSON string*/
+static void	bench_str(t_buf *buf, char *s)
+{
+	char	esc[7];
+
+	buf_append(buf, "\"", 1);
+	while (*s)
+	{
+		if (*s == '"' || *s == '\\')
+			buf_append(buf, "\\", 1);
+		if ((unsigned char)*s < 0x20)
+		{
+			ft_strlcpy(esc, "\\u0000", 7);
+			esc[4] = "0123456789abcdef"[*s >> 4];
+			esc[5] = "0123456789abcdef"[*s & 15];
+			buf_append(buf, esc, 6);
+		}
+		else
+			buf_append(buf, s, 1);
+		s++;
+	}
+	buf_append(buf, "\"", 1);
+}
+
+/*, "key": ns in seconds*/
+static void	bench_key(t_buf *buf, char *key, double ns)
+{
+	buf_append(buf, ",\n      \"", 9);
+	buf_append(buf, key, ft_strlen(key));
+	buf_append(buf, "\": ", 3);
+	bench_time(buf, ns, 1000000000L, 9);
+}
+
+static void	bench_times(t_buf *buf, t_bench *b)
+{
+	int	i;
+
+	buf_append(buf, ",\n      \"times\": [", 18);
+	i = 0;
+	while (i < b->done)
+	{
+		if (i)
+			buf_append(buf, ", ", 2);
+		bench_time(buf, b->ns[i++], 1000000000L, 9);
+	}
+	buf_append(buf, "]\n    }", 7);
+}
+
+static void	bench_one(t_buf *buf, t_bench *b, t_bench_set *s)
+{
+	buf_append(buf, "    {\n      \"command\": ", 23);
+	bench_str(buf, b->line);
+	buf_append(buf, ",\n      \"runs\": ", 16);
+	meter_num(buf, b->done, 0);
+	buf_append(buf, ",\n      \"warmup\": ", 18);
+	meter_num(buf, s->warmup, 0);
+	buf_append(buf, ",\n      \"outliers\": ", 20);
+	meter_num(buf, b->outliers, 0);
+	bench_key(buf, "mean", b->mean);
+	bench_key(buf, "stddev", b->sd);
+	bench_key(buf, "min", b->sorted[0]);
+	bench_key(buf, "median", bench_pct(b, 0.5));
+	bench_key(buf, "p95", bench_pct(b, 0.95));
+	bench_key(buf, "p99", bench_pct(b, 0.99));
+	bench_key(buf, "max", b->sorted[b->done - 1]);
+	bench_key(buf, "user", (double)b->user / b->done);
+	bench_key(buf, "system", (double)b->sys / b->done);
+	bench_key(buf, "overhead", s->overhead);
+	bench_times(buf, b);
+}
+
+/*Every result, times in seconds, to the --json file*/
+int	bench_json(t_bench_set *s)
+{
+	t_buf	buf;
+	int		fd;
+	int		i;
+
+	buf_init(&buf);
+	buf_append(&buf, "{\n  \"results\": [\n", 17);
+	i = 0;
+	while (i < s->n)
+	{
+		if (i)
+			buf_append(&buf, ",\n", 2);
+		bench_one(&buf, &s->b[i++], s);
+	}
+	buf_append(&buf, "\n  ]\n}\n", 7);
+	fd = open(s->json, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	i = (fd < 0 || !buf.data || write_all(fd, buf.data, buf.len));
+	if (i)
+		cmd_error("bench", s->json, strerror(errno));
+	if (fd >= 0)
+		close(fd);
+	buf_free(&buf);
+	return (i);
+}
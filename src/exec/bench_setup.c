@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_setup.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:56:44 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:53:27 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*The word quoted so that the lexer gives it back as it is: left bare
+ * when it only holds plain characters, else in '...' with each ' as
+ * "'"*/
+static char	*bench_quote(char *word)
+{
+	t_buf	buf;
+	int		err;
+	int		i;
+
+	i = 0;
+	while (word[i] && (ft_isalnum(word[i]) || ft_strchr("-_./=:,+%@",
+				word[i])))
+		i++;
+	if (word[0] && !word[i])
+		return (ft_strdup(word));
+	buf_init(&buf);
+	err = buf_append(&buf, "'", 1);
+	i = -1;
+	while (word[++i])
+	{
+		if (word[i] == '\'')
+			err |= buf_append(&buf, "'\"'\"'", 5);
+		else
+			err |= buf_append(&buf, &word[i], 1);
+	}
+	if (err || buf_append(&buf, "'", 1))
+		return (buf_free(&buf), NULL);
+	return (buf_release(&buf));
+}
+
+/*The words as one command line whose words are those words, already
+ * expanded once by the shell: nothing in them is expanded again*/
+static char	*bench_join(char **words)
+{
+	char	*line;
+	int		i;
+
+	line = bench_quote(words[0]);
+	i = 1;
+	while (line && words[i])
+	{
+		line = join_and_free(line, ft_strdup(" "));
+		if (line)
+			line = join_and_free(line, bench_quote(words[i]));
+		i++;
+	}
+	return (line);
+}
+
+static int	bench_load(t_bench *b, char *line, int runs, t_shell *shell)
+{
+	b->line = line;
+	b->ns = malloc(runs * sizeof(long));
+	b->sorted = malloc(runs * sizeof(long));
+	if (!b->line || !b->ns || !b->sorted)
+		return (1);
+	b->tokens = lexer(b->line);
+	if (!b->tokens)
+		ft_putendl_fd("minishell: bench: empty command", 2);
+	b->tree = parser(b->tokens, shell, NULL);
+	return (!b->tree || heredoc_attach(b->tree, shell));
+}
+
+/*Parses each command once: every word is one with --compare, as is a
+ * lone word, else the words are those of a single simple command.
+ * Returns 1 on a syntax error*/
+int	bench_parse(char **words, t_bench_set *s, t_shell *shell)
+{
+	char	*line;
+	int		i;
+
+	s->n = 1;
+	while (s->compare && words[s->n])
+		s->n++;
+	s->b = ft_calloc(s->n, sizeof(t_bench));
+	if (!s->b)
+		return (1);
+	i = 0;
+	while (i < s->n)
+	{
+		if (s->compare || !words[1])
+			line = ft_strdup(words[i]);
+		else
+			line = bench_join(words);
+		if (bench_load(&s->b[i], line, s->runs, shell))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+int	bench_free(t_bench_set *s, int status)
+{
+	int	i;
+
+	i = 0;
+	while (s->b && i < s->n)
+	{
+		free_tree(s->b[i].tree);
+		free_tokens(s->b[i].tokens);
+		free(s->b[i].line);
+		free(s->b[i].ns);
+		free(s->b[i].sorted);
+		i++;
+	}
+	free(s->b);
+	return (status);
+}
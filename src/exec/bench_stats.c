@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_stats.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:56:44 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:33:11 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static int	bench_cmp(const void *a, const void *b)
+{
+	return ((*(long *)a > *(long *)b) - (*(long *)a < *(long *)b));
+}
+
+/*The p quantile of the sorted runs, between the two nearest ones*/
+double	bench_pct(t_bench *b, double p)
+{
+	double	pos;
+	int		i;
+
+	pos = p * (b->done - 1);
+	i = (int)pos;
+	if (i + 1 >= b->done)
+		return (b->sorted[b->done - 1]);
+	return (b->sorted[i] + (pos - i) * (b->sorted[i + 1] - b->sorted[i]));
+}
+
+/*Sorts a copy of the runs for the quantiles, the runs themselves stay
+ * in the order they ran. Counts as outliers those beyond Tukey's
+ * fences, BENCH_FENCE interquartile ranges off the quartiles*/
+void	bench_stats(t_bench *b)
+{
+	double	sum;
+	double	lo;
+	double	hi;
+	int		i;
+
+	ft_memcpy(b->sorted, b->ns, b->done * sizeof(long));
+	qsort(b->sorted, b->done, sizeof(long), bench_cmp);
+	i = 0;
+	while (i < b->done)
+		b->mean += b->ns[i++];
+	b->mean /= b->done;
+	sum = 0;
+	while (i-- > 0)
+		sum += (b->ns[i] - b->mean) * (b->ns[i] - b->mean);
+	if (b->done > 1)
+		b->sd = sqrt(sum / (b->done - 1));
+	lo = bench_pct(b, 0.25);
+	hi = bench_pct(b, 0.75);
+	sum = BENCH_FENCE * (hi - lo);
+	i = b->done;
+	while (i-- > 0)
+		if (b->sorted[i] < lo - sum || b->sorted[i] > hi + sum)
+			b->outliers++;
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cat_copy.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:28:42 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:28:42 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*The kernel copy suited to the pair, nothing crossing user space but
+ * with the buffered fallback. -1 when in is the file out writes to*/
+static int	cat_mode(int in, int out)
+{
+	struct stat	si;
+	struct stat	so;
+
+	if (fstat(in, &si) < 0 || fstat(out, &so) < 0)
+		return (CAT_RW);
+	if (S_ISREG(si.st_mode) && S_ISREG(so.st_mode)
+		&& si.st_dev == so.st_dev && si.st_ino == so.st_ino)
+		return (-1);
+	if (S_ISREG(si.st_mode) && S_ISREG(so.st_mode))
+		return (CAT_RANGE);
+	if (S_ISFIFO(si.st_mode) || S_ISFIFO(so.st_mode))
+		return (CAT_SPLICE);
+	if (S_ISREG(si.st_mode))
+		return (CAT_SENDFILE);
+	return (CAT_RW);
+}
+
+/*One kernel copy in the current mode. A mode the pair turns out not to
+ * take, across filesystems, to an O_APPEND file or a tty, gives way to
+ * the next: copy_file_range to sendfile, any to read/write. Returns the
+ * bytes moved, -1 with the mode at CAT_RW when none could*/
+static ssize_t	cat_kernel(int in, int out, int *mode)
+{
+	ssize_t	n;
+
+	n = -1;
+	if (*mode == CAT_RANGE)
+		n = copy_file_range(in, NULL, out, NULL, CAT_CHUNK, 0);
+	else if (*mode == CAT_SPLICE)
+		n = splice(in, NULL, out, NULL, CAT_CHUNK, SPLICE_F_MOVE);
+	else if (*mode == CAT_SENDFILE)
+		n = sendfile(out, in, NULL, CAT_CHUNK);
+	if (n >= 0 || !(errno == EINVAL || errno == EXDEV || errno == ENOSYS
+			|| errno == EOPNOTSUPP || errno == EBADF))
+		return (n);
+	if (*mode == CAT_RANGE)
+		*mode = CAT_SENDFILE;
+	else
+		*mode = CAT_RW;
+	if (*mode != CAT_RW)
+		return (cat_kernel(in, out, mode));
+	return (-1);
+}
+
+/*Moves the next chunk, through a buffer once no kernel copy will do.
+ * Returns the bytes moved, 0 at end of input*/
+static ssize_t	cat_move(int in, int out, int *mode)
+{
+	char	buf[CAT_BUF];
+	ssize_t	n;
+
+	n = -1;
+	if (*mode != CAT_RW)
+		n = cat_kernel(in, out, mode);
+	if (*mode == CAT_RW)
+	{
+		n = read(in, buf, CAT_BUF);
+		if (n > 0 && write_all(out, buf, n))
+			n = -1;
+	}
+	if (n < 0 && errno == EINTR)
+		return (cat_move(in, out, mode));
+	return (n);
+}
+
+/*Copies in to its end onto out. Returns 0, 1 on an error with errno
+ * set, 2 if in and out are the same file*/
+int	cat_fd(int in, int out)
+{
+	int		mode;
+	ssize_t	n;
+
+	mode = cat_mode(in, out);
+	if (mode < 0)
+		return (2);
+	n = 1;
+	while (n > 0)
+		n = cat_move(in, out, &mode);
+	return (n < 0);
+}
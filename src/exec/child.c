@@ -6,7 +6,7 @@
 /*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/27 15:17:07 by abroslav          #+#    #+#             */
-/*   Updated: 2026/02/16 17:30:59 by abroslav         ###   ########.fr       */
+/*   Updated: 2026/10/19 12:27:11 by abroslav         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -54,7 +54,7 @@ void	handle_pipes(t_cmd *cmd, int fd_in, int *fd_pipe)
 		dup2(fd_in, STDIN_FILENO);
 		close(fd_in);
 	}
-	if (cmd->next)
+	if (cmd->next && fd_pipe[1] >= 0)
 	{
 		close(fd_pipe[0]);
 		dup2(fd_pipe[1], STDOUT_FILENO);
@@ -62,18 +62,29 @@ void	handle_pipes(t_cmd *cmd, int fd_in, int *fd_pipe)
 	}
 }
 
+/*Runs cmd in this child and exits. A compound command is already in a
+ * process of its own here, so a ( list ) runs its list directly*/
 static void	child_exec(t_cmd *cmd, t_shell *shell)
 {
-	int	status;
-
+	if (cmd->body && cmd->body->type == ND_SUBSHELL)
+		exec_tree(cmd->body->left, shell);
+	else if (cmd->body)
+		exec_tree(cmd->body, shell);
+	if (cmd->body)
+		cleanup_exit_child(shell, shell->exit_code);
 	if (!cmd->args || !cmd->args[0])
 		cleanup_exit_child(shell, 0);
+	stage_prefix(cmd, shell);
 	if (cmd->args[0][0] == '\0')
 		execution_error(cmd->args[0], 127, shell);
-	if (is_builtin(cmd->args))
+	if (exec_internal(cmd, shell))
+		cleanup_exit_child(shell, shell->exit_code);
+	if (args_exceed_arg_max(cmd->args, shell->env_vars))
 	{
-		status = exec_builtin(cmd, shell);
-		cleanup_exit_child(shell, status);
+		ft_putstr_fd("minishell: ", 2);
+		ft_putstr_fd(cmd->args[0], 2);
+		ft_putendl_fd(": Argument list too long", 2);
+		cleanup_exit_child(shell, 126);
 	}
 	handle_exec_path(cmd, shell);
 }
@@ -82,8 +93,11 @@ void	child_process(t_cmd *cmd, int fd_in, int *fd_pipe, t_shell *shell)
 {
 	signal(SIGINT, SIG_DFL);
 	signal(SIGQUIT, SIG_DFL);
+	meter_drop(shell);
+	stage_policy(cmd, shell);
 	handle_pipes(cmd, fd_in, fd_pipe);
 	if (handle_redirection(cmd) != 0)
 		cleanup_exit_child(shell, 1);
+	tee_detach(cmd, shell);
 	child_exec(cmd, shell);
 }
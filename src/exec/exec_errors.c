@@ -6,7 +6,7 @@
 /*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/12 20:57:23 by abroslav          #+#    #+#             */
-/*   Updated: 2026/02/16 16:56:06 by abroslav         ###   ########.fr       */
+/*   Updated: 2026/10/19 13:31:47 by abroslav         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -78,3 +78,15 @@ void	execution_error(char *cmd, int code, t_shell *shell)
 		print_error_message(cmd, strerror(errno));
 	cleanup_exit_child(shell, code);
 }
+
+/*minishell: cmd: arg: msg. Returns 1, the status to fail with*/
+int	cmd_error(char *cmd, char *arg, char *msg)
+{
+	ft_putstr_fd("minishell: ", 2);
+	ft_putstr_fd(cmd, 2);
+	ft_putstr_fd(": ", 2);
+	ft_putstr_fd(arg, 2);
+	ft_putstr_fd(": ", 2);
+	ft_putendl_fd(msg, 2);
+	return (1);
+}
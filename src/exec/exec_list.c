@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_list.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:31:18 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 11:49:25 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Whether the list being run has to stop short: on Ctrl-C, or once
+ * return ran, until the function call it ends is back*/
+int	exec_stopped(t_shell *shell)
+{
+	return (g_last_signal == SIGINT || shell->returning);
+}
+
+/*if cond; then ...; elif ...; else ...; fi. $? is that of the branch
+ * taken, 0 when none is*/
+static void	exec_if(t_node *node, t_shell *shell)
+{
+	exec_tree(node->left, shell);
+	if (exec_stopped(shell))
+		return ;
+	if (shell->exit_code == 0)
+		exec_tree(node->right, shell);
+	else if (node->alt)
+		exec_tree(node->alt, shell);
+	else
+		shell->exit_code = 0;
+}
+
+/*Runs a parsed command line. Each pipeline goes through executor(),
+ * so a lone builtin still runs in the shell itself. && and || skip
+ * their right side on failure or success. A pipeline killed by
+ * Ctrl-C stops the whole list*/
+void	exec_tree(t_node *node, t_shell *shell)
+{
+	if (!node)
+		return ;
+	if (node->type == ND_IF)
+		exec_if(node, shell);
+	else if (node->type == ND_WHILE || node->type == ND_UNTIL)
+		exec_while(node, shell);
+	else if (node->type == ND_FOR)
+		exec_for(node, shell);
+	else if (node->type == ND_FUNC)
+		func_define(node->func, shell);
+	else if (node->type == ND_PIPELINE)
+		executor(node->cmds, shell);
+	else if (node->type == ND_SUBSHELL)
+		exec_subshell(node->left, shell);
+	else
+		exec_tree(node->left, shell);
+	if (node->type != ND_AND && node->type != ND_OR && node->type != ND_SEQ)
+		return ;
+	if (exec_stopped(shell))
+		return ;
+	if ((node->type == ND_AND && shell->exit_code != 0)
+		|| (node->type == ND_OR && shell->exit_code == 0))
+		return ;
+	exec_tree(node->right, shell);
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_loop.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:46:30 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 11:46:30 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*while and until run the same parsed body every time round; only its
+ * words are expanded again, as they are for any pipeline. $? is that
+ * of the last run of the body, 0 when it never ran*/
+void	exec_while(t_node *node, t_shell *shell)
+{
+	int	status;
+
+	status = 0;
+	while (!exec_stopped(shell))
+	{
+		exec_tree(node->left, shell);
+		if (exec_stopped(shell)
+			|| (shell->exit_code == 0) == (node->type == ND_UNTIL))
+			break ;
+		exec_tree(node->right, shell);
+		status = shell->exit_code;
+	}
+	if (!shell->returning)
+		shell->exit_code = status;
+}
+
+/*The words of a for loop, expanded once when it starts, or $1 $2 ...
+ * without 'in'. The fields are taken off the t_cmd, so a run of the
+ * same loop from within the body expands into a list of its own*/
+static int	for_fields(t_node *node, char ***fields, t_shell *shell)
+{
+	*fields = NULL;
+	if (!node->cmds)
+	{
+		if (shell->params)
+			*fields = copy_env(shell->params);
+		return (shell->params && !*fields);
+	}
+	if (expand_cmd(node->cmds, shell))
+		return (1);
+	*fields = node->cmds->args;
+	node->cmds->args = NULL;
+	return (0);
+}
+
+void	exec_for(t_node *node, t_shell *shell)
+{
+	char	**fields;
+	char	*var;
+	int		i;
+
+	if (for_fields(node, &fields, shell))
+	{
+		shell->exit_code = 1;
+		return ;
+	}
+	shell->exit_code = 0;
+	i = 0;
+	while (fields && fields[i] && !exec_stopped(shell))
+	{
+		var = ft_strjoin(node->name, fields[i++]);
+		if (var)
+			update_env(var, &shell->env_vars);
+		free(var);
+		exec_tree(node->right, shell);
+	}
+	free_tab(fields);
+}
@@ -6,7 +6,7 @@
 /*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/07 11:11:22 by abroslav          #+#    #+#             */
-/*   Updated: 2026/02/06 17:41:07 by abroslav         ###   ########.fr       */
+/*   Updated: 2026/10/19 13:31:47 by abroslav         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,8 +14,10 @@
 
 /* Save originals FDs fro  terminal.
  * Try redir if it fail -> code 1
- * Execute a single builtin on the parent process and back to the bash*/
-static void	exec_single_builtin(t_cmd *cmd, t_shell *shell)
+ * Execute a single builtin, function, compound command or assignment,
+ * on the parent process and back to the bash. An assignment leaves $?
+ * to its last $(...), 0 without one*/
+static void	exec_in_parent(t_cmd *cmd, t_shell *shell)
 {
 	int	tmp_stdin;
 	int	tmp_stdout;
@@ -24,35 +26,40 @@ static void	exec_single_builtin(t_cmd *cmd, t_shell *shell)
 	tmp_stdout = dup(STDOUT_FILENO);
 	if (handle_redirection(cmd) != 0)
 		shell->exit_code = 1;
+	else if (cmd->body)
+		exec_tree(cmd->body, shell);
+	else if (is_right_assignment(cmd->args[0]))
+	{
+		update_env(cmd->args[0], &shell->env_vars);
+		if (!shell->substs)
+			shell->exit_code = 0;
+	}
 	else
-		shell->exit_code = exec_builtin(cmd, shell);
+		exec_internal(cmd, shell);
 	dup2(tmp_stdin, STDIN_FILENO);
 	dup2(tmp_stdout, STDOUT_FILENO);
 	close(tmp_stdin);
 	close(tmp_stdout);
+	tee_wait(cmd);
 }
 
 /*Wait untill all the child process end.
- * The exit_code final always will be the last status from the last cmd*/
+ * The exit_code final always will be the last status from the last cmd
+ * Adaptive pipes are grown while waiting for it
+ * Process substitution children are reaped too, their status ignored*/
 static void	wait_children(pid_t last_pid, t_shell *shell)
 {
 	int	status;
-	int	sig;
 
 	if (last_pid <= 0)
 		return ;
-	waitpid(last_pid, &status, 0);
-	if (WIFEXITED(status))
-		shell->exit_code = WEXITSTATUS(status);
-	else if (WIFSIGNALED(status))
-	{
-		sig = WTERMSIG(status);
-		if (sig == SIGQUIT)
-			ft_putstr_fd("Quit (core dump)\n", 2);
-		else if (sig == SIGINT)
-			ft_putstr_fd("\n", 2);
-		shell->exit_code = 128 + sig;
-	}
+	if (shell->pipe_size < 0)
+		pipe_adapt_wait(last_pid, &status, shell);
+	else
+		waitpid(last_pid, &status, 0);
+	if (WIFEXITED(status) || WIFSIGNALED(status))
+		shell->exit_code = report_status(status);
+	procsub_release(shell, 1);
 	while (waitpid(-1, NULL, 0) > 0)
 		;
 }
@@ -63,15 +70,20 @@ static void	pipe_loop(t_cmd *cmd, int *fd_in, pid_t *pid, t_shell *sh)
 
 	while (cmd)
 	{
-		if (cmd->next && pipe(fd_pipe) == -1)
+		cmd = pipe_inline(cmd, fd_in, pid, sh);
+		if (!cmd || (cmd->next && pipe_open(fd_pipe, sh) == -1))
 			break ;
 		*pid = fork();
 		if (*pid == 0)
 			child_process(cmd, *fd_in, fd_pipe, sh);
 		if (*fd_in != -1)
 			close(*fd_in);
+		if (cmd->heredoc_fd >= 0)
+			close(cmd->heredoc_fd);
+		cmd->heredoc_fd = -1;
 		if (cmd->next)
 		{
+			pipe_track(fd_pipe[1], *pid, sh);
 			close(fd_pipe[1]);
 			*fd_in = fd_pipe[0];
 		}
@@ -83,34 +95,53 @@ void	execute_pipe(t_cmd *cmd, t_shell *shell)
 {
 	int		fd_in;
 	pid_t	pid;
+	int		status;
 
 	pid = -1;
 	fd_in = -1;
 	setup_signals_execution();
+	pipe_size_start(cmd, shell);
 	pipe_loop(cmd, &fd_in, &pid, shell);
 	if (fd_in != -1)
 		close(fd_in);
+	meter_run(shell);
+	status = meter_join(shell);
+	procsub_close_fds(shell);
 	wait_children(pid, shell);
+	if (status >= 0)
+		shell->exit_code = status;
+	free(shell->stages);
+	shell->stages = NULL;
 	setup_signals();
 }
 
 /*high-level executor that decides the execuion path.
  * If it's a single builtin, it runs int the parent process, otherwise
- * initiates the pipeline logic
- * If redirs fail we dont execute just update exit_code*/
+ * initiates the pipeline logic, as the optimizer rewrote it for this run
+ * If redirs fail we dont execute just update exit_code
+ * A streamed heredoc pump runs alongside and is reaped at the end*/
 void	executor(t_cmd *cmd, t_shell *shell)
 {
+	t_popt	opt;
+	t_cmd	*run;
+
 	if (!cmd)
 		return ;
-	process_heredocs(cmd, shell->env_vars, shell->exit_code);
-	if (!cmd->next && cmd->args && is_right_assignment(cmd->args[0]))
+	shell->s_cmds = cmd;
+	process_heredocs(cmd, shell);
+	heredoc_stream_start(shell);
+	shell->substs = 0;
+	if (expand_pipeline(cmd, shell))
+		shell->exit_code = 1;
+	else
 	{
-		update_env(cmd->args[0], &shell->env_vars);
-		shell->exit_code = 0;
-		return ;
+		run = pipe_opt(cmd, &opt, shell);
+		if (runs_forked(run, shell))
+			execute_pipe(run, shell);
+		else
+			exec_in_parent(run, shell);
+		pipe_opt_undo(&opt, shell);
 	}
-	else if (!cmd->next && cmd->args && is_builtin(cmd->args))
-		exec_single_builtin(cmd, shell);
-	else
-		execute_pipe(cmd, shell);
+	procsub_release(shell, 1);
+	heredoc_stream_finish(cmd, shell);
 }
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   func.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:45:31 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 11:45:31 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static unsigned int	func_hash(char *name)
+{
+	unsigned int	h;
+
+	h = 5381;
+	while (*name)
+		h = h * 33 + (unsigned char)*name++;
+	return (h % FUNC_TABLE_SIZE);
+}
+
+/*The function called name, NULL when there is none*/
+t_func	*func_find(t_shell *shell, char *name)
+{
+	t_func	*fn;
+
+	if (!name)
+		return (NULL);
+	fn = shell->funcs[func_hash(name)];
+	while (fn && ft_strcmp(fn->name, name) != 0)
+		fn = fn->next;
+	return (fn);
+}
+
+/*Adds fn to the table, in place of any function of the same name. The
+ * table takes a reference of its own, the parse tree keeps its one*/
+void	func_define(t_func *fn, t_shell *shell)
+{
+	t_func	**slot;
+	t_func	*old;
+
+	slot = &shell->funcs[func_hash(fn->name)];
+	while (*slot && ft_strcmp((*slot)->name, fn->name) != 0)
+		slot = &(*slot)->next;
+	old = *slot;
+	if (old)
+		*slot = old->next;
+	fn->refs++;
+	fn->next = shell->funcs[func_hash(fn->name)];
+	shell->funcs[func_hash(fn->name)] = fn;
+	func_release(old);
+	shell->exit_code = 0;
+}
+
+/*Drops a reference. A function redefined while it runs is freed when
+ * its last call returns*/
+void	func_release(t_func *fn)
+{
+	if (!fn || --fn->refs > 0)
+		return ;
+	free(fn->name);
+	free_cmds(fn->body);
+	free(fn);
+}
+
+void	func_clear(t_shell *shell)
+{
+	t_func	*fn;
+	t_func	*next;
+	int		i;
+
+	i = 0;
+	while (i < FUNC_TABLE_SIZE)
+	{
+		fn = shell->funcs[i];
+		while (fn)
+		{
+			next = fn->next;
+			fn->next = NULL;
+			func_release(fn);
+			fn = next;
+		}
+		shell->funcs[i++] = NULL;
+	}
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   func_call.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:46:09 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 11:46:09 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Puts back what local changed in the call, then frees the records*/
+static void	frame_restore(t_frame *frame, t_shell *shell)
+{
+	t_local	*loc;
+	char	*unset_args[3];
+
+	while (frame->locals)
+	{
+		loc = frame->locals;
+		frame->locals = loc->next;
+		if (loc->old)
+			update_env(loc->old, &shell->env_vars);
+		else
+		{
+			unset_args[0] = "unset";
+			unset_args[1] = loc->name;
+			unset_args[2] = NULL;
+			ft_unset(unset_args, &shell->env_vars);
+		}
+		free(loc->name);
+		free(loc->old);
+		free(loc);
+	}
+}
+
+/*Records name as it is before local changes it, once per call.
+ * Returns 1 on error*/
+int	frame_save_local(t_frame *frame, char *name, t_shell *shell)
+{
+	t_local	*loc;
+	size_t	len;
+	int		i;
+
+	loc = frame->locals;
+	while (loc && ft_strcmp(loc->name, name) != 0)
+		loc = loc->next;
+	if (loc)
+		return (0);
+	loc = ft_calloc(1, sizeof(t_local));
+	if (!loc)
+		return (1);
+	loc->next = frame->locals;
+	frame->locals = loc;
+	loc->name = ft_strdup(name);
+	len = ft_strlen(name);
+	i = 0;
+	while (shell->env_vars[i] && (ft_strncmp(shell->env_vars[i], name, len)
+			|| (shell->env_vars[i][len] && shell->env_vars[i][len] != '=')))
+		i++;
+	if (shell->env_vars[i])
+		loc->old = ft_strdup(shell->env_vars[i]);
+	return (!loc->name || (shell->env_vars[i] && !loc->old));
+}
+
+static int	func_too_deep(t_shell *shell, char *name)
+{
+	if (!shell->frame || shell->frame->depth < FUNC_MAX_DEPTH)
+		return (0);
+	ft_putstr_fd("minishell: ", 2);
+	ft_putstr_fd(name, 2);
+	ft_putendl_fd(": maximum function nesting level exceeded", 2);
+	shell->exit_code = 1;
+	return (1);
+}
+
+/*Runs fn in this process, with the call words as $1 $2 .... They are
+ * taken off cmd: a recursive call expands cmd again while this call
+ * still reads them*/
+void	func_call(t_func *fn, t_cmd *cmd, t_shell *shell)
+{
+	t_frame	frame;
+	char	**params;
+
+	if (func_too_deep(shell, fn->name))
+		return ;
+	frame.up = shell->frame;
+	frame.depth = 1;
+	if (frame.up)
+		frame.depth = frame.up->depth + 1;
+	frame.args = cmd->args;
+	cmd->args = NULL;
+	frame.locals = NULL;
+	params = shell->params;
+	shell->frame = &frame;
+	shell->params = frame.args + 1;
+	fn->refs++;
+	executor(fn->body, shell);
+	func_release(fn);
+	frame_restore(&frame, shell);
+	shell->frame = frame.up;
+	shell->params = params;
+	shell->returning = 0;
+	free_tab(frame.args);
+}
+
+/*Runs cmd if it names a function or a builtin, functions first.
+ * Returns 0, having run nothing, when it is neither*/
+int	exec_internal(t_cmd *cmd, t_shell *shell)
+{
+	t_func	*fn;
+
+	fn = func_find(shell, cmd->args[0]);
+	if (fn)
+		func_call(fn, cmd, shell);
+	else if (is_builtin(cmd->args))
+		shell->exit_code = exec_builtin(cmd, shell);
+	else
+		return (0);
+	return (1);
+}
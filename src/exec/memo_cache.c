@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memo_cache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:06 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:50:06 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*MINISHELL_MEMO_DIR, else minishell-memo in the XDG cache. Created on
+ * first use, private: entries hold whatever the commands printed*/
+char	*memo_dir(t_shell *shell)
+{
+	char	*dir;
+	char	*base;
+
+	dir = get_env_value(shell->env_vars, "MINISHELL_MEMO_DIR");
+	if (dir && *dir)
+		dir = ft_strdup(dir);
+	else
+	{
+		base = get_env_value(shell->env_vars, "XDG_CACHE_HOME");
+		if (base && *base)
+			return (memo_join(base, "minishell-memo"));
+		base = get_env_value(shell->env_vars, "HOME");
+		if (!base || !*base)
+			return (NULL);
+		base = memo_join(base, ".cache");
+		if (!base)
+			return (NULL);
+		mkdir(base, 0700);
+		dir = memo_join(base, "minishell-memo");
+		free(base);
+	}
+	return (dir);
+}
+
+/*The entry's file, named after both hashes in hex*/
+char	*memo_path(t_memo *m)
+{
+	char	name[MEMO_NAME_LEN + 1];
+	int		i;
+
+	if (!m->dir || (mkdir(m->dir, 0700) < 0 && errno != EEXIST))
+		return (NULL);
+	i = 0;
+	while (i < MEMO_NAME_LEN / 2)
+	{
+		name[i] = "0123456789abcdef"[m->a >> (60 - 4 * i) & 15];
+		name[i + MEMO_NAME_LEN / 2] = "0123456789abcdef"[m->b
+			>> (60 - 4 * i) & 15];
+		i++;
+	}
+	name[MEMO_NAME_LEN] = '\0';
+	return (memo_join(m->dir, name));
+}
+
+/*An entry is as old as its mtime, replays only touch the atime*/
+static int	memo_expired(t_memo *m, struct stat *st)
+{
+	struct timespec	now;
+	long			age;
+
+	if (!m->ttl.tv_sec && !m->ttl.tv_nsec)
+		return (0);
+	clock_gettime(CLOCK_REALTIME, &now);
+	age = (now.tv_sec - st->st_mtim.tv_sec) * 1000
+		+ (now.tv_nsec - st->st_mtim.tv_nsec) / 1000000;
+	return (age >= m->ttl.tv_sec * 1000 + m->ttl.tv_nsec / 1000000);
+}
+
+/*Prints a stored output. Returns its status, -1 for a miss*/
+int	memo_replay(t_memo *m)
+{
+	static const struct timespec	times[2] = {{0, UTIME_NOW},
+	{0, UTIME_OMIT}};
+	struct stat						st;
+	char							hdr[MEMO_HDR_LEN];
+	int								fd;
+	int								status;
+
+	fd = -1;
+	if (m->path)
+		fd = open(m->path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return (-1);
+	status = -1;
+	if (!fstat(fd, &st) && !memo_expired(m, &st)
+		&& read(fd, hdr, MEMO_HDR_LEN) == MEMO_HDR_LEN
+		&& !ft_strncmp(hdr, MEMO_HDR, 6) && hdr[MEMO_HDR_LEN - 1] == '\n')
+		status = ft_atoi(hdr + 6);
+	if (status >= 0)
+	{
+		futimens(fd, times);
+		cat_fd(fd, STDOUT_FILENO);
+	}
+	close(fd);
+	return (status);
+}
+
+/*Writes the entry aside and renames it in, so that a shell replaying
+ * the same key never sees half of it. Outputs of commands killed by a
+ * signal, or too large to keep, are not stored*/
+void	memo_store(t_memo *m, int out, int status)
+{
+	char	hdr[MEMO_HDR_LEN + 1];
+	char	*tmp;
+	char	*pid;
+	off_t	len;
+	int		fd;
+
+	len = lseek(out, 0, SEEK_END);
+	if (status > 125 || len < 0 || len > m->max || lseek(out, 0, SEEK_SET))
+		return ;
+	pid = ft_itoa(getpid());
+	tmp = ft_strjoin(m->path, pid);
+	free(pid);
+	fd = -1;
+	if (tmp)
+		fd = open(tmp, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+	ft_strlcpy(hdr, MEMO_HDR, MEMO_HDR_LEN + 1);
+	hdr[6] += status / 100;
+	hdr[7] += status / 10 % 10;
+	hdr[8] += status % 10;
+	len = (fd < 0 || write_all(fd, hdr, MEMO_HDR_LEN) || cat_fd(out, fd));
+	if (fd >= 0 && (close(fd) || len || rename(tmp, m->path)))
+		unlink(tmp);
+	free(tmp);
+	memo_evict(m);
+}
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memo_key.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:06 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 13:52:08 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Feeds the key both an FNV-1a and a multiply-xorshift hash, so that two
+ * different inputs only share an entry if both collide. The length goes
+ * in last to keep "ab" "c" apart from "a" "bc"*/
+void	memo_mix(t_memo *m, const void *data, size_t n)
+{
+	const unsigned char	*p;
+	size_t				i;
+
+	p = data;
+	i = 0;
+	while (i < n)
+	{
+		m->a = (m->a ^ p[i]) * MEMO_FNV_PRIME;
+		m->b = (m->b + p[i] + 1) * MEMO_MIX;
+		m->b ^= m->b >> 29;
+		i++;
+	}
+	m->a = (m->a ^ n) * MEMO_FNV_PRIME;
+	m->b = (m->b ^ n) * MEMO_MIX;
+}
+
+/*A dependency counts by its size, mtime and inode rather than its
+ * content, the way make sees it. A missing file is an input too*/
+void	memo_dep(t_memo *m, char *file)
+{
+	struct stat	st;
+
+	ft_bzero(&st, sizeof(struct stat));
+	stat(file, &st);
+	memo_mix(m, "dep", 3);
+	memo_mix(m, file, ft_strlen(file));
+	memo_mix(m, &st.st_size, sizeof(st.st_size));
+	memo_mix(m, &st.st_mtim.tv_sec, sizeof(st.st_mtim.tv_sec));
+	memo_mix(m, &st.st_mtim.tv_nsec, sizeof(st.st_mtim.tv_nsec));
+	memo_mix(m, &st.st_ino, sizeof(st.st_ino));
+	memo_mix(m, &st.st_dev, sizeof(st.st_dev));
+}
+
+/*Unset and set to "" are different inputs*/
+void	memo_env(t_memo *m, char *name, char **env)
+{
+	char	*value;
+
+	value = get_env_value(env, name);
+	memo_mix(m, "env", 3);
+	memo_mix(m, name, ft_strlen(name));
+	if (value)
+		memo_mix(m, value, ft_strlen(value) + 1);
+	else
+		memo_mix(m, "", 0);
+}
+
+/*dir/name*/
+char	*memo_join(char *dir, char *name)
+{
+	char	*tmp;
+	char	*path;
+
+	tmp = ft_strjoin(dir, "/");
+	if (!tmp)
+		return (NULL);
+	path = ft_strjoin(tmp, name);
+	free(tmp);
+	return (path);
+}
@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memo_run.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:06 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 13:52:47 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static int	memo_ent_cmp(const void *a, const void *b)
+{
+	const struct timespec	*x;
+	const struct timespec	*y;
+
+	x = &((const t_memo_ent *)a)->atime;
+	y = &((const t_memo_ent *)b)->atime;
+	if (x->tv_sec != y->tv_sec)
+		return ((x->tv_sec > y->tv_sec) - (x->tv_sec < y->tv_sec));
+	return ((x->tv_nsec > y->tv_nsec) - (x->tv_nsec < y->tv_nsec));
+}
+
+static int	memo_ent_add(t_memo_scan *s, char *name, struct stat *st)
+{
+	t_memo_ent	*v;
+
+	if (s->n == s->cap)
+	{
+		s->cap = s->cap * 2 + 16;
+		v = malloc(s->cap * sizeof(t_memo_ent));
+		if (!v)
+			return (1);
+		if (s->n)
+			ft_memcpy(v, s->v, s->n * sizeof(t_memo_ent));
+		free(s->v);
+		s->v = v;
+	}
+	s->v[s->n].name = ft_strdup(name);
+	if (!s->v[s->n].name)
+		return (1);
+	s->v[s->n].atime = st->st_atim;
+	s->v[s->n++].size = st->st_size;
+	s->total += st->st_size;
+	return (0);
+}
+
+/*Every entry of the cache with its size and last replay. Returns 1 if
+ * the listing could not be made whole*/
+static int	memo_scan(char *dir, t_memo_scan *s)
+{
+	DIR				*d;
+	struct dirent	*e;
+	struct stat		st;
+	int				err;
+
+	ft_bzero(s, sizeof(t_memo_scan));
+	d = opendir(dir);
+	if (!d)
+		return (1);
+	err = 0;
+	e = readdir(d);
+	while (e && !err)
+	{
+		if (e->d_name[0] != '.' && !fstatat(dirfd(d), e->d_name, &st, 0)
+			&& S_ISREG(st.st_mode))
+			err = memo_ent_add(s, e->d_name, &st);
+		e = readdir(d);
+	}
+	closedir(d);
+	return (err);
+}
+
+/*Least recently used first, until the cache fits MINISHELL_MEMO_SIZE.
+ * The cache is listed once and sorted, however many entries go*/
+void	memo_evict(t_memo *m)
+{
+	t_memo_scan	s;
+	char		*path;
+	int			i;
+
+	i = 0;
+	if (!memo_scan(m->dir, &s))
+	{
+		qsort(s.v, s.n, sizeof(t_memo_ent), memo_ent_cmp);
+		while (i < s.n && s.total > m->size)
+		{
+			path = memo_join(m->dir, s.v[i].name);
+			if (path && unlink(path) == 0)
+				s.total -= s.v[i].size;
+			free(path);
+			i++;
+		}
+	}
+	i = 0;
+	while (i < s.n)
+		free(s.v[i++].name);
+	free(s.v);
+}
+
+/*Runs the command with its stdout on a memfd, and stdin on the copy
+ * hashed into the key, then prints and stores what it wrote. The output
+ * shows up once the command is done, not as it goes*/
+int	memo_exec(t_memo *m, t_cmd *cmd, t_shell *shell)
+{
+	int	saved[2];
+	int	out;
+	int	status;
+
+	out = anon_file("minishell-memo");
+	saved[0] = -1;
+	if (m->in >= 0)
+		saved[0] = dup(STDIN_FILENO);
+	saved[1] = dup(STDOUT_FILENO);
+	if (out < 0 || saved[1] < 0 || (m->in >= 0 && (saved[0] < 0
+				|| dup2(m->in, STDIN_FILENO) < 0))
+		|| dup2(out, STDOUT_FILENO) < 0)
+		return (close(out), close(saved[0]), close(saved[1]),
+			perror("minishell: memo"), 1);
+	status = run_cmd_sync(cmd, shell);
+	dup2(saved[1], STDOUT_FILENO);
+	if (saved[0] >= 0)
+		dup2(saved[0], STDIN_FILENO);
+	close(saved[0]);
+	close(saved[1]);
+	if (lseek(out, 0, SEEK_SET) == 0)
+		cat_fd(out, STDOUT_FILENO);
+	memo_store(m, out, status);
+	close(out);
+	return (status);
+}
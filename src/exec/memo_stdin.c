@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memo_stdin.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:51:44 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:51:44 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Copies stdin into m->in while hashing it. Stops with m->over set once
+ * more than m->max bytes came in. Returns 1 on an error*/
+static int	memo_read(t_memo *m)
+{
+	char	buf[READ_ALL_CHUNK];
+	ssize_t	n;
+	long	total;
+
+	total = 0;
+	while (total <= m->max)
+	{
+		n = read(STDIN_FILENO, buf, READ_ALL_CHUNK);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			return (n < 0);
+		if (write_all(m->in, buf, n))
+			return (1);
+		memo_mix(m, buf, n);
+		total += n;
+	}
+	m->over = 1;
+	return (0);
+}
+
+/*Reads stdin into a memfd while hashing it, the command then gets the
+ * copy. Left alone when it is a terminal or the shell's own input, the
+ * script memo runs from is not the command's data*/
+int	memo_stdin(t_memo *m, t_shell *shell)
+{
+	struct stat	st;
+
+	if (isatty(STDIN_FILENO) || fstat(STDIN_FILENO, &st) < 0
+		|| (st.st_dev == shell->input.st_dev
+			&& st.st_ino == shell->input.st_ino))
+		return (0);
+	m->in = anon_file("minishell-memo");
+	if (m->in < 0)
+		return (1);
+	memo_mix(m, "stdin", 5);
+	if (memo_read(m) || lseek(m->in, 0, SEEK_SET) < 0)
+		return (1);
+	return (0);
+}
+
+/*Child side: the bytes memo already read, then the rest of stdin*/
+static void	memo_pump(t_memo *m, int *fd, t_shell *shell)
+{
+	signal(SIGPIPE, SIG_IGN);
+	close(fd[0]);
+	if (!cat_fd(m->in, fd[1]))
+		cat_fd(STDIN_FILENO, fd[1]);
+	close(fd[1]);
+	cleanup_exit_child(shell, 0);
+}
+
+/*stdin ran past MINISHELL_MEMO_MAX, too much to key on: the command
+ * runs uncached, on a pipe a pump feeds what was read and then the
+ * rest of the stream. The pump goes once the command is done*/
+int	memo_pass(t_memo *m, t_cmd *cmd, t_shell *shell)
+{
+	int		fd[2];
+	int		saved;
+	pid_t	pid;
+	int		status;
+
+	if (pipe(fd) < 0)
+		return (perror("minishell: memo"), 1);
+	pid = fork();
+	if (pid == 0)
+		memo_pump(m, fd, shell);
+	close(fd[1]);
+	saved = dup(STDIN_FILENO);
+	if (pid < 0 || saved < 0 || dup2(fd[0], STDIN_FILENO) < 0)
+		return (close(fd[0]), close(saved), perror("minishell: memo"), 1);
+	close(fd[0]);
+	status = run_cmd_sync(cmd, shell);
+	dup2(saved, STDIN_FILENO);
+	close(saved);
+	kill(pid, SIGKILL);
+	while (waitpid(pid, NULL, 0) < 0 && errno == EINTR)
+		;
+	return (status);
+}
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   meter.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:23:11 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:23:11 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Moves the next chunk from in to out: splice(2) while one side is a
+ * pipe, a buffer once the kernel refuses, as for a tty or two files.
+ * Counts and returns the bytes moved, 0 at end of input, -1 on error*/
+static ssize_t	meter_move(t_meter *m)
+{
+	char	buf[TEE_CHUNK];
+	ssize_t	n;
+
+	n = -1;
+	errno = EINVAL;
+	if (!m->copy)
+		n = splice(m->in, NULL, m->out, NULL, METER_CHUNK,
+				SPLICE_F_MOVE | SPLICE_F_MORE);
+	if (n < 0 && errno == EINVAL)
+	{
+		m->copy = 1;
+		n = read(m->in, buf, TEE_CHUNK);
+		if (n > 0 && write_all(m->out, buf, n))
+			n = -1;
+	}
+	if (n < 0 && errno == EINTR)
+		return (meter_move(m));
+	if (n > 0)
+		m->bytes += n;
+	return (n);
+}
+
+/*Copies in to out, counting. With stderr a tty a progress line is
+ * redrawn every METER_TICK_MS, the totals always end it.
+ * Returns 1 if the copy stopped on an error*/
+int	meter_copy(t_meter *m)
+{
+	struct timespec	start;
+	struct timespec	tick;
+	ssize_t			n;
+	int				tty;
+
+	tty = isatty(STDERR_FILENO);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	tick = start;
+	n = 1;
+	while (n > 0)
+	{
+		n = meter_move(m);
+		if (tty && meter_ms(&tick) >= METER_TICK_MS)
+		{
+			meter_report(m, &start, "\033[K\r");
+			clock_gettime(CLOCK_MONOTONIC, &tick);
+		}
+	}
+	if (n < 0 && errno != EPIPE)
+		perror("minishell: meter");
+	if (tty)
+		meter_report(m, &start, "\033[K\n");
+	else
+		meter_report(m, &start, "\n");
+	return (n < 0);
+}
+
+/*A stage forked after a meter was set holds its ends too: one that
+ * does not exec would keep the meter's readers from ever seeing EOF.
+ * Its own pipelines have no meters of this one to start*/
+void	meter_drop(t_shell *shell)
+{
+	t_meter	*m;
+
+	while (shell->meters)
+	{
+		m = shell->meters;
+		shell->meters = m->next;
+		close(m->in);
+		close(m->out);
+		free(m->name);
+		free(m);
+	}
+}
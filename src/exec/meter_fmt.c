@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   meter_fmt.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:23:11 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:59:24 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Milliseconds since a CLOCK_MONOTONIC reading*/
+long	meter_ms(struct timespec *since)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((now.tv_sec - since->tv_sec) * 1000
+		+ (now.tv_nsec - since->tv_nsec) / 1000000);
+}
+
+/*n in decimal, zero padded to width digits*/
+void	meter_num(t_buf *b, long n, int width)
+{
+	char	digits[24];
+	int		i;
+
+	i = 24;
+	while (i > 0 && (n > 0 || width > 0 || i == 24))
+	{
+		digits[--i] = '0' + n % 10;
+		n /= 10;
+		width--;
+	}
+	buf_append(b, digits + i, 24 - i);
+}
+
+/*A byte count the way pv and ls -h write it: 1.21 GiB*/
+static void	meter_human(t_buf *b, long n)
+{
+	char	*units;
+	long	div;
+	int		u;
+
+	units = "KMGTPE";
+	div = 1;
+	u = -1;
+	while (units[u + 1] && n / div >= 1024)
+	{
+		div *= 1024;
+		u++;
+	}
+	meter_num(b, n / div, 0);
+	if (u >= 0)
+	{
+		buf_append(b, ".", 1);
+		meter_num(b, n % div / (div / 100), 2);
+	}
+	buf_append(b, " ", 1);
+	if (u >= 0)
+		buf_append(b, units + u, 1);
+	if (u >= 0)
+		buf_append(b, "i", 1);
+	buf_append(b, "B", 1);
+}
+
+/*meter: NAME: 1.21 GiB in 3.40s (364.12 MiB/s) then end, to stderr in
+ * one write so stages' meters do not interleave within a line*/
+void	meter_report(t_meter *m, struct timespec *start, char *end)
+{
+	t_buf	b;
+	long	ms;
+
+	ms = meter_ms(start);
+	buf_init(&b);
+	buf_append(&b, "meter: ", 7);
+	if (m->name)
+		buf_append(&b, m->name, ft_strlen(m->name));
+	if (m->name)
+		buf_append(&b, ": ", 2);
+	meter_human(&b, m->bytes);
+	buf_append(&b, " in ", 4);
+	meter_num(&b, ms / 1000, 0);
+	buf_append(&b, ".", 1);
+	meter_num(&b, ms % 1000 / 10, 2);
+	buf_append(&b, "s (", 3);
+	if (ms < 1)
+		ms = 1;
+	meter_human(&b, m->bytes * 1000 / ms);
+	buf_append(&b, "/s)", 3);
+	buf_append(&b, end, ft_strlen(end));
+	if (b.data)
+		write_all(STDERR_FILENO, b.data, b.len);
+	buf_free(&b);
+}
@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   meter_thread.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:23:11 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:43:32 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Meter or cat thread. A reader gone is EPIPE here, SIGPIPE would take the
+ * whole shell down. Its ends are closed as soon as it is done, so the
+ * stages on either side see EOF and EPIPE as with a forked stage*/
+static void	*meter_main(void *arg)
+{
+	t_meter		*m;
+	sigset_t	set;
+
+	m = arg;
+	sigemptyset(&set);
+	sigaddset(&set, SIGPIPE);
+	pthread_sigmask(SIG_BLOCK, &set, NULL);
+	if (m->files)
+		m->status = cat_files(m->files, m->in, m->out);
+	else
+		m->status = meter_copy(m);
+	close(m->out);
+	close(m->in);
+	return (NULL);
+}
+
+/*Starts the pipeline's meters, once all its stages are forked: no child
+ * is ever forked from a shell with threads running. One that does not
+ * start drops its ends, failing its neighbours like a stage that died*/
+void	meter_run(t_shell *shell)
+{
+	t_meter	*m;
+
+	m = shell->meters;
+	while (m)
+	{
+		m->started = !pthread_create(&m->thread, NULL, meter_main, m);
+		if (!m->started)
+		{
+			perror("minishell: meter");
+			close(m->out);
+			close(m->in);
+		}
+		m = m->next;
+	}
+}
+
+/*Gives in and out to a new meter or cat for cmd, started once every stage is
+ * forked. Returns 1 if there is none, the ends are still the caller's*/
+static int	meter_add(t_cmd *cmd, int in, int out, t_shell *shell)
+{
+	t_meter	*m;
+
+	m = ft_calloc(1, sizeof(t_meter));
+	if (!m || in < 0 || out < 0)
+		return (free(m), 1);
+	if (!ft_strcmp(cmd->args[0], "cat"))
+		m->files = cmd->args + 1;
+	else if (meter_opts(cmd->args, &m->name))
+		return (free(m), 1);
+	m->in = in;
+	m->out = out;
+	m->last = !cmd->next;
+	m->status = 1;
+	fcntl(in, F_SETFD, FD_CLOEXEC);
+	fcntl(out, F_SETFD, FD_CLOEXEC);
+	m->next = shell->meters;
+	shell->meters = m;
+	return (0);
+}
+/*Sets the meter or cat cmd between *fd_in, the shell's stdin for the first
+ * stage, and a new pipe, the shell's stdout for the last one. Both ends
+ * are the meter's from now on; *fd_in becomes the next stage's input.
+ * Returns the command after it*/
+t_cmd	*meter_start(t_cmd *cmd, int *fd_in, t_shell *shell)
+{
+	int	fds[2];
+
+	fds[0] = -1;
+	fds[1] = -1;
+	if (!cmd->next)
+		fds[1] = dup(STDOUT_FILENO);
+	else
+		pipe_open(fds, shell);
+	if (*fd_in < 0)
+		*fd_in = dup(STDIN_FILENO);
+	if (meter_add(cmd, *fd_in, fds[1], shell))
+	{
+		perror("minishell: meter");
+		if (*fd_in >= 0)
+			close(*fd_in);
+		if (fds[1] >= 0)
+			close(fds[1]);
+	}
+	*fd_in = fds[0];
+	return (cmd->next);
+}
+
+/*Waits for the pipeline's meters. Returns the status of the one ending
+ * it, -1 if the last stage is not a meter*/
+int	meter_join(t_shell *shell)
+{
+	t_meter	*m;
+	int		status;
+
+	status = -1;
+	while (shell->meters)
+	{
+		m = shell->meters;
+		shell->meters = m->next;
+		if (m->started)
+			pthread_join(m->thread, NULL);
+		if (m->last)
+			status = m->status;
+		free(m->name);
+		free(m);
+	}
+	return (status);
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   multios.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:11:03 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:11:03 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Multios: with more than one > or >> the command writes to a pipe and
+ * a pump copies it to every file, as in zsh. Makes room for the files
+ * when there are two or more. Returns 1 if it cannot*/
+int	tee_init(t_tee *tee, t_redir *redir)
+{
+	int	n;
+
+	ft_bzero(tee, sizeof(t_tee));
+	n = 0;
+	while (redir)
+	{
+		if (redir->type == REDIR_OUT || redir->type == REDIR_APPEND)
+			n++;
+		redir = redir->next;
+	}
+	if (n < 2)
+		return (0);
+	tee->out = malloc(sizeof(int) * n);
+	return (tee->out == NULL);
+}
+
+/*Right after a redirection is applied: a file just opened on stdout
+ * is kept for the pump*/
+void	tee_keep(t_tee *tee, t_redir *redir)
+{
+	if (tee->out && (redir->type == REDIR_OUT || redir->type == REDIR_APPEND))
+		tee->out[tee->n++] = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, 0);
+}
+
+static void	tee_pump(t_tee *tee, int *fds, int *done)
+{
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+	close(fds[1]);
+	close(done[0]);
+	close(STDIN_FILENO);
+	close(STDOUT_FILENO);
+	tee->in = fds[0];
+	tee_run(tee);
+	_exit(0);
+}
+
+/*The pump is forked twice over, so no wait for children in the shell
+ * can block on it while the shell itself still feeds it. It holds the
+ * write end of done, and the returned read end sees EOF once it is
+ * through. -1 if it could not start*/
+static int	tee_spawn(t_tee *tee, int *fds)
+{
+	int		done[2];
+	pid_t	pid;
+	int		status;
+
+	if (pipe2(done, O_CLOEXEC) < 0)
+		return (-1);
+	pid = fork();
+	if (pid == 0)
+	{
+		pid = fork();
+		if (pid == 0)
+			tee_pump(tee, fds, done);
+		_exit(pid < 0);
+	}
+	status = 1;
+	if (pid > 0)
+		waitpid(pid, &status, 0);
+	close(done[1]);
+	if (status == 0)
+		return (done[0]);
+	close(done[0]);
+	return (-1);
+}
+
+/*Starts the pump and points stdout at it. Whoever runs the command
+ * waits for it with tee_wait() once the command is done*/
+int	tee_start(t_cmd *cmd, t_tee *tee)
+{
+	int	fds[2];
+
+	if (!tee->out)
+		return (0);
+	cmd->tee_fd = -1;
+	if (pipe2(fds, O_CLOEXEC) == 0)
+	{
+		cmd->tee_fd = tee_spawn(tee, fds);
+		if (cmd->tee_fd >= 0)
+			dup2(fds[1], STDOUT_FILENO);
+		close(fds[0]);
+		close(fds[1]);
+	}
+	tee_drop(tee);
+	if (cmd->tee_fd >= 0)
+		return (0);
+	perror("minishell: multios");
+	return (1);
+}
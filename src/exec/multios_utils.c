@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   multios_utils.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:11:03 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:11:03 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+void	tee_drop(t_tee *tee)
+{
+	while (tee->n > 0)
+	{
+		tee->n--;
+		if (tee->out[tee->n] >= 0)
+			close(tee->out[tee->n]);
+	}
+	free(tee->out);
+	tee->out = NULL;
+	free(tee->tmp);
+	tee->tmp = NULL;
+}
+
+/*Blocks until the multios pump of cmd has written everything*/
+void	tee_wait(t_cmd *cmd)
+{
+	char	c;
+
+	if (cmd->tee_fd < 0)
+		return ;
+	while (read(cmd->tee_fd, &c, 1) < 0 && errno == EINTR)
+		;
+	close(cmd->tee_fd);
+	cmd->tee_fd = -1;
+}
+
+/*A pipeline child must not exit before its files are complete, yet
+ * the command may exec. So the command runs in a process of its own,
+ * and this one drops its ends, waits for both and exits the way the
+ * command did*/
+void	tee_detach(t_cmd *cmd, t_shell *shell)
+{
+	pid_t	pid;
+	int		status;
+
+	if (cmd->tee_fd < 0)
+		return ;
+	pid = fork();
+	if (pid <= 0)
+		return ;
+	close(STDIN_FILENO);
+	close(STDOUT_FILENO);
+	status = 0;
+	while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
+		;
+	tee_wait(cmd);
+	if (WIFSIGNALED(status))
+	{
+		signal(WTERMSIG(status), SIG_DFL);
+		kill(getpid(), WTERMSIG(status));
+	}
+	cleanup_exit_child(shell, exit_status_of(status));
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_adapt.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:01:50 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:01:50 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Opens /proc/<pid><leaf>, -1 if it cannot*/
+static int	proc_open(pid_t pid, char *leaf, int flags)
+{
+	char	*num;
+	char	*dir;
+	char	*path;
+	int		fd;
+
+	num = ft_itoa(pid);
+	dir = NULL;
+	if (num)
+		dir = ft_strjoin("/proc/", num);
+	path = NULL;
+	if (dir)
+		path = ft_strjoin(dir, leaf);
+	fd = -1;
+	if (path)
+		fd = open(path, flags | O_CLOEXEC);
+	free(num);
+	free(dir);
+	free(path);
+	return (fd);
+}
+
+/*The bytes pid has written so far, the wchar of its /proc io*/
+static long	stage_wchar(pid_t pid)
+{
+	char	buf[512];
+	char	*at;
+	ssize_t	len;
+	long	n;
+	int		fd;
+
+	fd = proc_open(pid, "/io", O_RDONLY);
+	if (fd < 0)
+		return (-1);
+	len = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (len <= 0)
+		return (-1);
+	buf[len] = '\0';
+	at = ft_strnstr(buf, "wchar: ", len);
+	if (!at)
+		return (-1);
+	at += 7;
+	n = 0;
+	while (ft_isdigit(*at))
+		n = n * 10 + (*at++ - '0');
+	return (n);
+}
+
+/*Doubles the pipe behind the stdout of a stage that wrote more than
+ * per_tick since the last sample. The pipe is reached through
+ * /proc/<pid>/fd/1 and only kept open for the fcntl. A stage whose
+ * pipe cannot grow is not tried again*/
+static void	pipe_adapt_one(t_stage *st, long per_tick, long max)
+{
+	long		wchar;
+	long		size;
+	int			fd;
+	struct stat	sb;
+
+	wchar = stage_wchar(st->pid);
+	if (wchar >= 0 && st->size > 0 && st->size < max
+		&& wchar - st->wchar > per_tick)
+	{
+		size = st->size * 2;
+		if (size > max)
+			size = max;
+		fd = proc_open(st->pid, "/fd/1", O_RDONLY | O_NONBLOCK | O_NOCTTY);
+		if (fd >= 0 && fstat(fd, &sb) == 0 && S_ISFIFO(sb.st_mode)
+			&& fcntl(fd, F_SETPIPE_SZ, (int)size) >= 0)
+			st->size = size;
+		else
+			st->size = max;
+		if (fd >= 0)
+			close(fd);
+	}
+	if (wchar >= 0)
+		st->wchar = wchar;
+}
+
+/*Waits for last as waitpid would. Meanwhile every PIPE_ADAPT_TICK_MS the
+ * stages writing to pipes are sampled, and one writing faster than
+ * MINISHELL_PIPE_RATE bytes/s (PIPE_ADAPT_RATE by default) gets its
+ * pipe doubled, up to pipe-max-size*/
+void	pipe_adapt_wait(pid_t last, int *status, t_shell *shell)
+{
+	long	per_tick;
+	long	max;
+	pid_t	ret;
+	int		i;
+
+	per_tick = pipe_size_parse(get_env_value(shell->env_vars,
+				"MINISHELL_PIPE_RATE"));
+	if (per_tick <= 0)
+		per_tick = PIPE_ADAPT_RATE;
+	per_tick = per_tick / 1000 * PIPE_ADAPT_TICK_MS;
+	max = pipe_max_size();
+	ret = waitpid(last, status, WNOHANG);
+	while (ret == 0 || (ret < 0 && errno == EINTR))
+	{
+		usleep(PIPE_ADAPT_TICK_MS * 1000);
+		i = 0;
+		while (i < shell->n_stages)
+			pipe_adapt_one(&shell->stages[i++], per_tick, max);
+		ret = waitpid(last, status, WNOHANG);
+	}
+	if (ret < 0)
+		*status = 0;
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_fanout.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:12:54 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:43:32 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Pump side of a fan-out: keeps only the input and the write ends, not
+ * the readers' ends nor the pipe after them, rd[n] and rd[n + 1]*/
+static void	fanout_run(t_tee *tee, int *rd, int in, t_shell *sh)
+{
+	int	i;
+
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+	close_heredoc_fds(sh->s_cmds);
+	meter_drop(sh);
+	i = 0;
+	while (i < tee->n + 2)
+	{
+		if (rd[i] >= 0)
+			close(rd[i]);
+		i++;
+	}
+	tee->in = in;
+	tee_run(tee);
+	tee_drop(tee);
+	cleanup_exit_child(sh, 0);
+}
+
+/*Gives each of the k readers a pipe of its own and forks the tee pump
+ * that fills them all from in. The read ends go to rd, the pipe after
+ * the group is already in rd[k]. Returns 1 if the pump did not start*/
+static int	fanout_pump(int in, int *rd, int k, t_shell *sh)
+{
+	t_tee	tee;
+	int		fds[2];
+	pid_t	pid;
+
+	ft_bzero(&tee, sizeof(t_tee));
+	tee.out = malloc(sizeof(int) * k);
+	while (tee.out && tee.n < k && pipe2(fds, O_CLOEXEC) == 0)
+	{
+		rd[tee.n] = fds[0];
+		tee.out[tee.n++] = fds[1];
+	}
+	pid = -1;
+	if (tee.out && tee.n == k)
+		pid = fork();
+	if (pid == 0)
+		fanout_run(&tee, rd, in, sh);
+	while (pid < 0 && tee.n > 0)
+		close(rd[tee.n-- - 1]);
+	tee_drop(&tee);
+	return (pid < 0);
+}
+
+/*Forks the readers, the ith reading rd[i] and writing to z when the
+ * group has a command after it; their read ends run up to z. Each
+ * child drops the read ends of the readers after it, so a reader that
+ * quits leaves its pipe readerless and the pump drops it. Returns the
+ * pid of the last reader*/
+static pid_t	fanout_readers(t_cmd *cmd, int *rd, int *z, t_shell *sh)
+{
+	t_cmd	*c;
+	pid_t	pid;
+	int		i;
+	int		j;
+
+	c = cmd;
+	i = 0;
+	while (c && (c == cmd || c->fanout))
+	{
+		pid = fork();
+		j = i + 1;
+		while (pid == 0 && rd + j < z)
+			close(rd[j++]);
+		if (pid == 0)
+			child_process(c, rd[i], z, sh);
+		close(rd[i++]);
+		if (c->heredoc_fd >= 0)
+			close(c->heredoc_fd);
+		c->heredoc_fd = -1;
+		c = c->next;
+	}
+	return (pid);
+}
+
+/*Readers joined by |+ each get a copy of what the command before them
+ * writes: a tee pump, forked and reaped like any stage, duplicates it
+ * in kernel pipe buffers. Together they write to the pipe of the
+ * command after the group, if any. Returns that command*/
+static t_cmd	*fanout_group(t_cmd *cmd, int *fd_in, pid_t *pid, t_shell *sh)
+{
+	int		*rd;
+	int		k;
+	t_cmd	*after;
+
+	k = 1;
+	after = cmd->next;
+	while (after && after->fanout)
+	{
+		after = after->next;
+		k++;
+	}
+	rd = malloc(sizeof(int) * (k + 2));
+	if (!rd)
+		return (after);
+	ft_memset(rd, -1, sizeof(int) * (k + 2));
+	if ((after && pipe(rd + k) < 0) || fanout_pump(*fd_in, rd, k, sh))
+		perror("minishell: fan-out");
+	else
+		*pid = fanout_readers(cmd, rd, rd + k, sh);
+	close(*fd_in);
+	if (rd[k + 1] >= 0)
+		close(rd[k + 1]);
+	*fd_in = rd[k];
+	free(rd);
+	return (after);
+}
+
+/*Stages the shell runs without forking one of its own for them: fan-out
+ * groups, meters and cats. Not one reading a terminal as the shell's
+ * stdin, ^C could not stop a thread. Returns the next command to fork*/
+t_cmd	*pipe_inline(t_cmd *cmd, int *fd_in, pid_t *pid, t_shell *sh)
+{
+	while (cmd && (cmd->fanout || (meter_threaded(cmd, sh)
+				&& (*fd_in >= 0 || !isatty(STDIN_FILENO)))))
+	{
+		if (cmd->fanout)
+			cmd = fanout_group(cmd, fd_in, pid, sh);
+		else
+			cmd = meter_start(cmd, fd_in, sh);
+	}
+	return (cmd);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_opt.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:54:58 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:20:33 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*"... | cat" copies stdin to stdout and nothing else. When stdout is
+ * not a terminal cat changes nothing, it just leaves the pipeline*/
+static void	opt_tail(t_cmd *cmds, t_popt *opt, t_shell *shell)
+{
+	t_cmd	*last;
+
+	last = cmds;
+	while (last->next->next)
+		last = last->next;
+	if (!pipe_opt_is(last->next, "cat", shell) || last->next->args[1]
+		|| last->next->fanout || isatty(STDOUT_FILENO))
+		return ;
+	opt->cut = last->next;
+	last->next = NULL;
+	if (!runs_forked(cmds, shell))
+	{
+		last->next = opt->cut;
+		opt->cut = NULL;
+		return ;
+	}
+	opt->last = last;
+	pipe_opt_dump(opt->cut, NULL, shell);
+}
+
+/*The redirection standing in for a leading "cat FILE" or "echo WORDS".
+ * cat only when the file opens as cat would, so errors stay cat's*/
+static t_redir	*opt_head_redir(t_cmd *head, t_shell *shell)
+{
+	t_redir		*redir;
+	t_buf		words;
+	struct stat	st;
+
+	redir = ft_calloc(1, sizeof(t_redir));
+	if (!redir)
+		return (NULL);
+	buf_init(&words);
+	if (pipe_opt_is(head, "cat", shell) && head->args[1] && !head->args[2]
+		&& head->args[1][0] != '-' && stat(head->args[1], &st) == 0
+		&& !S_ISDIR(st.st_mode) && access(head->args[1], R_OK) == 0)
+		redir->file = ft_strdup(head->args[1]);
+	else if (pipe_opt_is(head, "echo", shell)
+		&& !(head->args[1] && head->args[1][0] == '-')
+		&& !pipe_opt_words(&words, head->args + 1))
+	{
+		redir->type = REDIR_HERESTR;
+		redir->file = buf_release(&words);
+	}
+	buf_free(&words);
+	if (!redir->file)
+		return (free(redir), NULL);
+	return (redir);
+}
+
+/*Rewrites the expanded pipeline for this run, cmds as parsed are kept:
+ * a trailing "| cat" is cut when stdout is not a tty, a leading
+ * "cat FILE |" turns into "< FILE" on the next command and a leading
+ * "echo WORDS |" into an in-memory here-string. Returns the new head.
+ * MINISHELL_NOPIPEOPT=1 turns it off*/
+t_cmd	*pipe_opt(t_cmd *cmds, t_popt *opt, t_shell *shell)
+{
+	t_redir	*redir;
+
+	ft_bzero(opt, sizeof(t_popt));
+	if (!cmds->next || env_flag(shell->env_vars, "MINISHELL_NOPIPEOPT"))
+		return (cmds);
+	opt_tail(cmds, opt, shell);
+	if (!cmds->next || cmds->next->fanout || !runs_forked(cmds->next, shell))
+		return (cmds);
+	redir = opt_head_redir(cmds, shell);
+	if (!redir)
+		return (cmds);
+	redir->next = cmds->next->redirs;
+	cmds->next->redirs = redir;
+	opt->fed = cmds->next;
+	pipe_opt_dump(cmds, redir, shell);
+	return (cmds->next);
+}
+
+/*Puts the pipeline back as parsed. Without the cut cat the status was
+ * its writer's, with it the status is cat's own 0*/
+void	pipe_opt_undo(t_popt *opt, t_shell *shell)
+{
+	t_redir	*redir;
+
+	if (opt->fed)
+	{
+		redir = opt->fed->redirs;
+		opt->fed->redirs = redir->next;
+		free(redir->file);
+		free(redir);
+	}
+	if (opt->cut)
+	{
+		opt->last->next = opt->cut;
+		if (g_last_signal != SIGINT)
+			shell->exit_code = 0;
+	}
+}
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_opt_utils.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:54:44 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:43:32 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Whether the pipeline runs in children. A lone builtin, function,
+ * compound or assignment runs in the shell itself, but for cat and
+ * meter: they may block on a terminal that ^C must get them out of*/
+int	runs_forked(t_cmd *cmd, t_shell *shell)
+{
+	if (cmd->next)
+		return (1);
+	return (!cmd->body && !(cmd->args && ((is_builtin(cmd->args)
+					&& !is_stream_builtin(cmd->args))
+				|| func_find(shell, cmd->args[0])
+				|| is_right_assignment(cmd->args[0]))));
+}
+
+/*A plain run of the real command: no redirections, not compound and
+ * not shadowed by a function*/
+int	pipe_opt_is(t_cmd *cmd, char *name, t_shell *shell)
+{
+	return (!cmd->body && !cmd->redirs && cmd->args && cmd->args[0]
+		&& ft_strcmp(cmd->args[0], name) == 0 && !func_find(shell, name));
+}
+
+/*Appends args separated by spaces, the way echo prints them*/
+int	pipe_opt_words(t_buf *buf, char **args)
+{
+	int	i;
+
+	i = 0;
+	while (args && args[i])
+	{
+		if (i > 0 && buf_append(buf, " ", 1))
+			return (1);
+		if (buf_append(buf, args[i], ft_strlen(args[i])))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/*MINISHELL_PIPEOPT_DEBUG=1 reports each rewrite on stderr, one line:
+ * "cat f | => < f" for a head, "| cat => dropped" for a tail*/
+void	pipe_opt_dump(t_cmd *cmd, t_redir *redir, t_shell *shell)
+{
+	t_buf	out;
+	int		err;
+
+	if (!env_flag(shell->env_vars, "MINISHELL_PIPEOPT_DEBUG"))
+		return ;
+	buf_init(&out);
+	err = buf_append(&out, "minishell: pipeopt: ", 20);
+	if (!redir)
+		err = err || buf_append(&out, "| ", 2);
+	err = err || pipe_opt_words(&out, cmd->args);
+	if (!redir)
+		err = err || buf_append(&out, " => dropped\n", 12);
+	else if (redir->type == REDIR_IN)
+		err = err || buf_append(&out, " | => < ", 8);
+	else
+		err = err || buf_append(&out, " | => <<< ", 10);
+	if (redir)
+		err = err || buf_append(&out, redir->file, ft_strlen(redir->file))
+			|| buf_append(&out, "\n", 1);
+	if (!err)
+		write_all(STDERR_FILENO, out.data, out.len);
+	buf_free(&out);
+}
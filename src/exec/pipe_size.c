@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_size.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:01:10 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:20:33 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*A size like 65536, 64K or 1M, in bytes. Returns -1 when malformed*/
+long	pipe_size_parse(char *s)
+{
+	long	n;
+
+	if (!s || !ft_isdigit(*s))
+		return (-1);
+	n = 0;
+	while (ft_isdigit(*s) && n < INT_MAX)
+		n = n * 10 + (*s++ - '0');
+	if (*s == 'K' || *s == 'k')
+		n *= 1024;
+	else if (*s == 'M' || *s == 'm')
+		n *= 1024 * 1024;
+	if (*s && (s[1] || !ft_strchr("KkMm", *s)))
+		return (-1);
+	if (n <= 0 || n > INT_MAX)
+		return (-1);
+	return (n);
+}
+
+/*The most an unprivileged F_SETPIPE_SZ may ask for*/
+long	pipe_max_size(void)
+{
+	char	buf[32];
+	ssize_t	len;
+	int		fd;
+
+	fd = open("/proc/sys/fs/pipe-max-size", O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return (PIPE_MAX_DEFAULT);
+	len = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (len <= 0)
+		return (PIPE_MAX_DEFAULT);
+	buf[len] = '\0';
+	if (buf[len - 1] == '\n')
+		buf[len - 1] = '\0';
+	len = pipe_size_parse(buf);
+	if (len <= 0)
+		return (PIPE_MAX_DEFAULT);
+	return (len);
+}
+
+/*MINISHELL_PIPE_SIZE sizes the pipes of the next pipeline: a size like
+ * 1M, capped at pipe-max-size, or "auto" to start at the default and
+ * grow the pipes of fast writers while it runs. Unset keeps 64K*/
+void	pipe_size_start(t_cmd *cmd, t_shell *shell)
+{
+	char	*value;
+	int		n;
+
+	free(shell->stages);
+	shell->stages = NULL;
+	shell->n_stages = 0;
+	value = get_env_value(shell->env_vars, "MINISHELL_PIPE_SIZE");
+	shell->pipe_size = pipe_size_parse(value);
+	if (shell->pipe_size > 0 && shell->pipe_size > pipe_max_size())
+		shell->pipe_size = pipe_max_size();
+	if (shell->pipe_size < 0)
+		shell->pipe_size = 0;
+	if (!value || ft_strcmp(value, "auto"))
+		return ;
+	n = 0;
+	while (cmd)
+	{
+		cmd = cmd->next;
+		n++;
+	}
+	shell->stages = ft_calloc(n, sizeof(t_stage));
+	if (shell->stages)
+		shell->pipe_size = -1;
+}
+
+/*pipe() for the next stage, sized as the pipeline asks before any
+ * writer starts*/
+int	pipe_open(int *fd_pipe, t_shell *shell)
+{
+	if (pipe(fd_pipe) == -1)
+		return (-1);
+	if (shell->pipe_size > 0)
+		fcntl(fd_pipe[1], F_SETPIPE_SZ, (int)shell->pipe_size);
+	return (0);
+}
+
+/*Remembers a stage writing to the pipe behind fd, when adaptive*/
+void	pipe_track(int fd, pid_t pid, t_shell *shell)
+{
+	t_stage	*st;
+
+	if (shell->pipe_size >= 0 || pid <= 0)
+		return ;
+	st = &shell->stages[shell->n_stages++];
+	st->pid = pid;
+	st->wchar = 0;
+	st->size = fcntl(fd, F_GETPIPE_SZ);
+}
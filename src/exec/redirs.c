@@ -6,7 +6,7 @@
 /*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/27 15:17:44 by abroslav          #+#    #+#             */
-/*   Updated: 2026/02/06 18:00:28 by abroslav         ###   ########.fr       */
+/*   Updated: 2026/10/19 12:20:33 by abroslav         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -50,36 +50,75 @@ static int	apply_heredoc(t_cmd *cmd)
 	if (dup2(cmd->heredoc_fd, STDIN_FILENO) == -1)
 		return (1);
 	close(cmd->heredoc_fd);
+	cmd->heredoc_fd = -1;
+	return (0);
+}
+
+/*Here-string: the word and a newline go straight into a pipe (a memfd
+ * if too big for one) before exec. No extra process, no file*/
+static int	apply_herestr(char *word)
+{
+	t_hd_ctx	ctx;
+	int			fd;
+
+	ctx.fd = -1;
+	buf_init(&ctx.body);
+	if (!word || buf_append(&ctx.body, word, ft_strlen(word))
+		|| buf_append(&ctx.body, "\n", 1))
+		return (buf_free(&ctx.body), 1);
+	fd = heredoc_deliver(&ctx);
+	if (fd < 0)
+		return (1);
+	if (dup2(fd, STDIN_FILENO) == -1)
+	{
+		close(fd);
+		return (1);
+	}
+	close(fd);
+	return (0);
+}
+
+/*Applies a single redirection, returns 1 if it fails*/
+static int	apply_one(t_cmd *cmd, t_redir *redir)
+{
+	if (redir->type == REDIR_IN)
+		return (apply_redir(redir->file, O_RDONLY, STDIN_FILENO));
+	else if (redir->type == REDIR_OUT)
+		return (apply_redir(redir->file, O_WRONLY | O_CREAT | O_TRUNC,
+				STDOUT_FILENO));
+	else if (redir->type == REDIR_APPEND)
+		return (apply_redir(redir->file, O_WRONLY | O_CREAT | O_APPEND,
+				STDOUT_FILENO));
+	else if (redir->type == REDIR_HEREDOC)
+		return (apply_heredoc(cmd));
+	else if (redir->type == REDIR_HERESTR)
+		return (apply_herestr(redir->file));
 	return (0);
 }
 
 /*Iterate through the comds list
  * Open files and redirects input/output using dup2
- * Break and returns 1 if any redir. fails*/
+ * Break and returns 1 if any redir. fails
+ * Two or more outputs all get the output, through a tee pump*/
 int	handle_redirection(t_cmd *cmd)
 {
 	t_redir	*redir;
-	int		status;
+	t_tee	tee;
 
 	if (!cmd)
 		return (0);
+	if (tee_init(&tee, cmd->redirs))
+		return (1);
 	redir = cmd->redirs;
 	while (redir)
 	{
-		status = 0;
-		if (redir->type == REDIR_IN)
-			status = apply_redir(redir->target, O_RDONLY, STDIN_FILENO);
-		else if (redir->type == REDIR_OUT)
-			status = apply_redir(redir->target, O_WRONLY | O_CREAT | \
-O_TRUNC, STDOUT_FILENO);
-		else if (redir->type == REDIR_APPEND)
-			status = apply_redir(redir->target, O_WRONLY | O_CREAT | \
-O_APPEND, STDOUT_FILENO);
-		else if (redir->type == REDIR_HEREDOC)
-			status = apply_heredoc(cmd);
-		if (status != 0)
+		if (apply_one(cmd, redir) != 0)
+		{
+			tee_drop(&tee);
 			return (1);
+		}
+		tee_keep(&tee, redir);
 		redir = redir->next;
 	}
-	return (0);
+	return (tee_start(cmd, &tee));
 }
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:50:41 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 13:50:42 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Translates a waitpid() status into the shell exit code convention*/
+int	exit_status_of(int status)
+{
+	if (WIFEXITED(status))
+		return (WEXITSTATUS(status));
+	if (WIFSIGNALED(status))
+		return (128 + WTERMSIG(status));
+	return (1);
+}
+
+/*exit_status_of() for a command the user waited on: a fatal SIGQUIT
+ * or SIGINT is told the way bash does, SIGINT stopping what follows*/
+int	report_status(int status)
+{
+	int	sig;
+
+	if (!WIFSIGNALED(status))
+		return (exit_status_of(status));
+	sig = WTERMSIG(status);
+	if (sig == SIGQUIT)
+		ft_putstr_fd("Quit (core dump)\n", 2);
+	else if (sig == SIGINT)
+		ft_putstr_fd("\n", 2);
+	if (sig == SIGINT)
+		g_last_signal = SIGINT;
+	return (128 + sig);
+}
+
+/*Forks and runs cmd through the normal child path (redirs, builtins,
+ * PATH lookup). Returns the pid of the child or -1 if fork fails*/
+pid_t	spawn_cmd(t_cmd *cmd, t_shell *shell)
+{
+	pid_t	pid;
+
+	pid = fork();
+	if (pid < 0)
+	{
+		perror("minishell: fork");
+		return (-1);
+	}
+	if (pid == 0)
+		child_process(cmd, -1, NULL, shell);
+	return (pid);
+}
+
+/*The parent ignores SIGINT/SIGQUIT while a child owns the terminal,
+ * then gets back whatever disposition it had before*/
+void	swap_job_signals(struct sigaction *old, int restore)
+{
+	struct sigaction	sa;
+
+	if (restore)
+	{
+		sigaction(SIGINT, &old[0], NULL);
+		sigaction(SIGQUIT, &old[1], NULL);
+		return ;
+	}
+	ft_memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = SIG_IGN;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGINT, &sa, &old[0]);
+	sigaction(SIGQUIT, &sa, &old[1]);
+}
+
+/*Runs a single command to completion and returns its exit code.
+ * Builtins with no effect on the shell stay in the current process,
+ * anything else is forked*/
+int	run_cmd_sync(t_cmd *cmd, t_shell *shell)
+{
+	struct sigaction	old[2];
+	pid_t				pid;
+	int					status;
+
+	if (is_pure_builtin(cmd->args))
+		return (exec_builtin(cmd, shell));
+	swap_job_signals(old, 0);
+	pid = spawn_cmd(cmd, shell);
+	status = 0;
+	if (pid > 0)
+		while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
+			;
+	swap_job_signals(old, 1);
+	if (pid < 0)
+		return (1);
+	return (exit_status_of(status));
+}
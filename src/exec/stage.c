@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stage.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:58:48 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 13:54:15 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static void	stage_usage(t_shell *shell)
+{
+	ft_putstr_fd("minishell: stage: usage: stage [-c cpus] [-n nice] [-b] ", 2);
+	ft_putendl_fd("[-i class[:level]] [-p pipe-size] command [args]", 2);
+	cleanup_exit_child(shell, 2);
+}
+
+static void	stage_warn(char opt)
+{
+	ft_putstr_fd("minishell: stage: -", 2);
+	ft_putchar_fd(opt, 2);
+	ft_putstr_fd(": ", 2);
+	ft_putendl_fd(strerror(errno), 2);
+}
+
+/*Option settings that do not take are reported, the command still runs
+ * the way taskset and nice leave it to the caller to care. -p has no
+ * pipe to size when stdout is something else, a trailing | cat the
+ * optimizer took out included, and is then left out quietly. Returns 1
+ * only on a malformed value*/
+static int	stage_apply(char opt, char *val)
+{
+	cpu_set_t			set;
+	int					n;
+	struct sched_param	sp;
+	struct stat			st;
+
+	n = 0;
+	if ((opt == 'c' && stage_cpulist(val, &set))
+		|| (opt == 'n' && stage_nice(val, &n))
+		|| (opt == 'i' && stage_ioprio(val) < 0)
+		|| (opt == 'p' && pipe_size_parse(val) < 0))
+		return (1);
+	errno = 0;
+	ft_bzero(&sp, sizeof(sp));
+	if ((opt == 'c' && sched_setaffinity(0, sizeof(set), &set))
+		|| (opt == 'n' && nice(n) == -1 && errno)
+		|| (opt == 'b' && sched_setscheduler(0, SCHED_BATCH, &sp))
+		|| (opt == 'p' && !fstat(STDOUT_FILENO, &st) && S_ISFIFO(st.st_mode)
+			&& fcntl(STDOUT_FILENO, F_SETPIPE_SZ,
+				(int)pipe_size_parse(val)) < 0)
+		|| (opt == 'i' && syscall(SYS_ioprio_set, STAGE_IOPRIO_WHO, 0,
+				stage_ioprio(val))))
+		stage_warn(opt);
+	return (0);
+}
+
+/*"stage [-c CPUS] [-n NICE] [-b] [-i CLASS[:LEVEL]] [-p SIZE] cmd" tunes
+ * this child: cpu affinity, nice, SCHED_BATCH, the io class and the
+ * buffer of the pipe it writes to. Then
+ * cmd takes its place in args. Only ever runs in a child, so a lone
+ * stage never touches the shell. A function named stage wins*/
+void	stage_prefix(t_cmd *cmd, t_shell *shell)
+{
+	char	**args;
+	int		i;
+	int		n;
+
+	args = cmd->args;
+	if (ft_strcmp(args[0], "stage") || func_find(shell, "stage"))
+		return ;
+	i = 1;
+	while (args[i] && args[i][0] == '-' && ft_strcmp(args[i], "--"))
+	{
+		if (ft_strlen(args[i]) != 2 || !ft_strchr("cnibp", args[i][1])
+			|| (args[i][1] != 'b' && !args[i + 1])
+			|| stage_apply(args[i][1], args[i + 1]))
+			stage_usage(shell);
+		i += 1 + (args[i][1] != 'b');
+	}
+	i += (args[i] && !ft_strcmp(args[i], "--"));
+	if (!args[i])
+		stage_usage(shell);
+	n = 0;
+	while (n < i)
+		free(args[n++]);
+	ft_memmove(args, args + i, (get_matrix_len(args + i) + 1)
+		* sizeof(char *));
+}
+
+/*MINISHELL_STAGE_CPUS="0-3,8" pins the stages of a pipeline round-robin
+ * over the list, "all" over every cpu the shell may use. Stage n gets
+ * the nth cpu, so neighbouring stages land on neighbouring cores. Lone
+ * commands are left alone, a stage prefix overrides it*/
+void	stage_policy(t_cmd *cmd, t_shell *shell)
+{
+	char		*list;
+	cpu_set_t	set;
+	t_cmd		*walk;
+	int			n;
+
+	list = get_env_value(shell->env_vars, "MINISHELL_STAGE_CPUS");
+	if (!list || !*list || (!cmd->next && cmd == shell->s_cmds))
+		return ;
+	if ((!ft_strcmp(list, "all") && sched_getaffinity(0, sizeof(set), &set))
+		|| (ft_strcmp(list, "all") && stage_cpulist(list, &set)))
+		return ;
+	n = 0;
+	walk = shell->s_cmds;
+	while (walk && walk != cmd)
+	{
+		walk = walk->next;
+		n++;
+	}
+	n = stage_nth_cpu(&set, n);
+	CPU_ZERO(&set);
+	CPU_SET(n, &set);
+	sched_setaffinity(0, sizeof(set), &set);
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stage_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:58:35 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 11:58:35 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Reads the decimal number at *s and moves past it, -1 if there is none.
+ * Capped, so a long run of digits cannot overflow*/
+static int	stage_num(char **s)
+{
+	int	n;
+
+	if (!ft_isdigit(**s))
+		return (-1);
+	n = 0;
+	while (ft_isdigit(**s))
+	{
+		if (n < STAGE_NUM_MAX)
+			n = n * 10 + (**s - '0');
+		(*s)++;
+	}
+	return (n);
+}
+
+/*Parses a cpu list like "0-3,8" into set. Returns 1 when malformed*/
+int	stage_cpulist(char *s, cpu_set_t *set)
+{
+	int	lo;
+	int	hi;
+
+	CPU_ZERO(set);
+	while (*s)
+	{
+		lo = stage_num(&s);
+		hi = lo;
+		if (*s == '-')
+		{
+			s++;
+			hi = stage_num(&s);
+		}
+		if (lo < 0 || hi < lo || hi >= CPU_SETSIZE)
+			return (1);
+		while (lo <= hi)
+			CPU_SET(lo++, set);
+		if (*s == ',' && s[1])
+			s++;
+		else if (*s)
+			return (1);
+	}
+	return (CPU_COUNT(set) == 0);
+}
+
+/*The nth cpu of set, counting round it again past the last one*/
+int	stage_nth_cpu(cpu_set_t *set, int n)
+{
+	int	cpu;
+
+	n = n % CPU_COUNT(set);
+	cpu = 0;
+	while (cpu < CPU_SETSIZE)
+	{
+		if (CPU_ISSET(cpu, set))
+		{
+			if (n == 0)
+				return (cpu);
+			n--;
+		}
+		cpu++;
+	}
+	return (-1);
+}
+
+/*"CLASS[:LEVEL]" as ionice takes it: rt, be or idle (or 1 to 3) and a
+ * level from 0 to 7. Returns the ioprio value, -1 when malformed*/
+int	stage_ioprio(char *s)
+{
+	int	class;
+	int	level;
+
+	if (!ft_strncmp(s, "idle", 4))
+	{
+		class = 3;
+		s += 4;
+	}
+	else if (!ft_strncmp(s, "rt", 2) || !ft_strncmp(s, "be", 2))
+	{
+		class = 1 + (s[0] == 'b');
+		s += 2;
+	}
+	else
+		class = stage_num(&s);
+	level = STAGE_IO_LEVEL;
+	if (*s == ':')
+	{
+		s++;
+		level = stage_num(&s);
+	}
+	if (*s || class < 1 || class > 3 || level < 0 || level > 7)
+		return (-1);
+	return (class << STAGE_IOPRIO_SHIFT | level);
+}
+
+/*A nice increment, signed. Returns 1 when malformed*/
+int	stage_nice(char *s, int *inc)
+{
+	int	sign;
+
+	sign = 1;
+	if (*s == '-')
+		sign = -1;
+	if (*s == '-' || *s == '+')
+		s++;
+	*inc = stage_num(&s);
+	if (*inc < 0 || *s)
+		return (1);
+	*inc *= sign;
+	return (0);
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   subshell.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:34:43 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 13:28:40 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Builtins whose only lasting effects are on the environment and the
+ * working directory, both of which a snapshot puts back. A function
+ * of the same name could do anything, exit included*/
+static int	restorable_cmd(t_cmd *cmd, t_shell *shell)
+{
+	char	*name;
+	int		i;
+
+	if (!cmd->words)
+		return (1);
+	i = 0;
+	while (cmd->words[i] && is_right_assignment(cmd->words[i]))
+		i++;
+	name = cmd->words[i];
+	if (!name)
+		return (1);
+	if (func_find(shell, name))
+		return (0);
+	return (!ft_strcmp(name, "echo") || !ft_strcmp(name, "cd")
+		|| !ft_strcmp(name, "pwd") || !ft_strcmp(name, "export")
+		|| !ft_strcmp(name, "unset") || !ft_strcmp(name, "env"));
+}
+
+/*Whether every command of body is such a builtin, judged on the words
+ * as typed: a name that needs expanding could be anything. A function
+ * definition, or alias and unalias, would outlive the snapshot*/
+static int	restorable(t_node *body, t_shell *shell)
+{
+	t_cmd	*cmd;
+
+	if (!body)
+		return (1);
+	if (body->type == ND_FUNC)
+		return (0);
+	cmd = NULL;
+	if (body->type == ND_PIPELINE)
+		cmd = body->cmds;
+	while (cmd)
+	{
+		if (cmd->body && !restorable(cmd->body, shell))
+			return (0);
+		if (!cmd->body && !restorable_cmd(cmd, shell))
+			return (0);
+		cmd = cmd->next;
+	}
+	return (restorable(body->left, shell) && restorable(body->right, shell)
+		&& restorable(body->alt, shell));
+}
+
+/*Runs body in the shell itself, between a snapshot and a restore of
+ * env_vars and of the cwd, held as a directory fd. $? is left as the
+ * body set it, like a subshell's status. Returns 1, having run
+ * nothing, when the snapshot can't be taken*/
+static int	subshell_inline(t_node *body, t_shell *shell)
+{
+	char	**env;
+	int		cwd;
+
+	cwd = open(".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (cwd < 0)
+		return (1);
+	env = copy_env(shell->env_vars);
+	if (!env)
+		return (close(cwd), 1);
+	exec_tree(body, shell);
+	if (fchdir(cwd) < 0)
+		perror("minishell: subshell");
+	close(cwd);
+	free_env(shell->env_vars);
+	shell->env_vars = env;
+	return (0);
+}
+
+static void	subshell_fork(t_node *body, t_shell *shell)
+{
+	struct sigaction	old[2];
+	pid_t				pid;
+	int					status;
+
+	swap_job_signals(old, 0);
+	pid = fork();
+	if (pid == 0)
+	{
+		signal(SIGINT, SIG_DFL);
+		signal(SIGQUIT, SIG_DFL);
+		exec_tree(body, shell);
+		cleanup_exit_child(shell, shell->exit_code);
+	}
+	status = 1 << 8;
+	while (pid > 0 && waitpid(pid, &status, 0) < 0 && errno == EINTR)
+		;
+	swap_job_signals(old, 1);
+	if (pid < 0)
+		perror("minishell: fork");
+	if (WIFSIGNALED(status) && WTERMSIG(status) == SIGINT)
+		g_last_signal = SIGINT;
+	shell->exit_code = exit_status_of(status);
+}
+
+/*( body ). The fork is skipped when all the body can change is put
+ * back by a snapshot, MINISHELL_SUBSHELL_FORK=1 forces it*/
+void	exec_subshell(t_node *body, t_shell *shell)
+{
+	if (restorable(body, shell)
+		&& !env_flag(shell->env_vars, "MINISHELL_SUBSHELL_FORK")
+		&& subshell_inline(body, shell) == 0)
+		return ;
+	subshell_fork(body, shell);
+}
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tee_pump.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:09:41 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:09:41 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*One private pipe per output, as big as the input, so a tee(2) of all
+ * the input holds always fits in an empty one*/
+static int	tee_pipes(t_tee *pump)
+{
+	int	i;
+	int	size;
+
+	size = fcntl(pump->in, F_GETPIPE_SZ);
+	pump->size = TEE_CHUNK;
+	if (size > 0)
+		pump->size = size;
+	pump->null = open("/dev/null", O_WRONLY | O_CLOEXEC);
+	pump->tmp = malloc(sizeof(int) * 2 * pump->n);
+	if (pump->null < 0 || !pump->tmp)
+		return (1);
+	i = 0;
+	while (i < pump->n)
+	{
+		if (pipe2(pump->tmp + 2 * i, O_CLOEXEC) < 0)
+			return (1);
+		if (size > 0)
+			fcntl(pump->tmp[2 * i + 1], F_SETPIPE_SZ, size);
+		i++;
+	}
+	return (0);
+}
+
+/*Moves len bytes out of pipe src into fd with splice(2). An fd that
+ * takes no splice, a tty, gets them through a buffer. Returns 1 once
+ * fd is gone*/
+static int	tee_move(int src, int fd, size_t len)
+{
+	char	buf[TEE_CHUNK];
+	ssize_t	n;
+
+	while (len > 0)
+	{
+		n = splice(src, NULL, fd, NULL, len, SPLICE_F_MOVE);
+		if (n < 0 && errno == EINVAL)
+		{
+			n = TEE_CHUNK;
+			if (len < TEE_CHUNK)
+				n = len;
+			n = read(src, buf, n);
+			if (n > 0 && write_all(fd, buf, n))
+				n = -1;
+		}
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			return (1);
+		len -= n;
+	}
+	return (0);
+}
+
+/*tee(2) of what the input holds into the private pipe of output i.
+ * Every output gets the same len as the first, one that cannot is
+ * dropped. Returns -1 at the end of the input*/
+static ssize_t	tee_link(t_tee *pump, int i, ssize_t len)
+{
+	ssize_t	got;
+
+	got = tee(pump->in, pump->tmp[2 * i + 1], pump->size, 0);
+	while (got < 0 && errno == EINTR)
+		got = tee(pump->in, pump->tmp[2 * i + 1], pump->size, 0);
+	if (!len && got <= 0)
+		return (-1);
+	if (len && got != len)
+		pump->out[i] = -1;
+	if (len)
+		return (len);
+	return (got);
+}
+
+/*Links what the input holds into the pipe of every live output, moves
+ * it on and drops the input's copy. Returns the bytes moved, 0 at the
+ * end of the input or when no output is left*/
+static ssize_t	tee_round(t_tee *pump)
+{
+	ssize_t	len;
+	int		i;
+
+	len = 0;
+	i = 0;
+	while (i < pump->n && len >= 0)
+	{
+		if (pump->out[i] >= 0)
+			len = tee_link(pump, i, len);
+		i++;
+	}
+	if (len <= 0)
+		return (0);
+	i = 0;
+	while (i < pump->n)
+	{
+		if (pump->out[i] >= 0 && tee_move(pump->tmp[2 * i], pump->out[i], len))
+			pump->out[i] = -1;
+		i++;
+	}
+	if (tee_move(pump->in, pump->null, len))
+		return (0);
+	return (len);
+}
+
+/*Pump side: everything read from in reaches every output, without a
+ * copy through user space. Each round tee(2) links the input's bytes
+ * into a private pipe per output and splice(2) moves them on, so the
+ * slowest output sets the pace. An output that fails is dropped and
+ * the others carry on; with none left the pump stops and the writer
+ * gets EPIPE*/
+void	tee_run(t_tee *pump)
+{
+	ssize_t	len;
+
+	signal(SIGPIPE, SIG_IGN);
+	if (tee_pipes(pump))
+	{
+		perror("minishell: tee");
+		return ;
+	}
+	len = 1;
+	while (len > 0)
+		len = tee_round(pump);
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timeout.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:46:11 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 13:49:57 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Hands the terminal from group from to group to, if from has it. A
+ * group that does not own it would get SIGTTIN on its first read, so
+ * the command takes it, and the shell takes it back once it is done.
+ * Returns whether to holds the terminal*/
+static int	timeout_tty(pid_t from, pid_t to)
+{
+	sigset_t	set;
+	sigset_t	old;
+
+	if (!isatty(STDIN_FILENO))
+		return (0);
+	if (tcgetpgrp(STDIN_FILENO) == from)
+	{
+		sigemptyset(&set);
+		sigaddset(&set, SIGTTOU);
+		sigprocmask(SIG_BLOCK, &set, &old);
+		tcsetpgrp(STDIN_FILENO, to);
+		sigprocmask(SIG_SETMASK, &old, NULL);
+	}
+	return (tcgetpgrp(STDIN_FILENO) == to);
+}
+
+/*No pidfd, so nothing to bound the wait with: the command goes. Keeps
+ * errno for the caller to report. Returns 1*/
+static int	timeout_abandon(t_timeout *t)
+{
+	int	err;
+
+	err = errno;
+	kill(-t->pid, SIGKILL);
+	while (waitpid(t->pid, NULL, 0) < 0 && errno == EINTR)
+		;
+	if (t->tty)
+		timeout_tty(tcgetpgrp(STDIN_FILENO), t->pgrp);
+	errno = err;
+	return (1);
+}
+
+/*Forks the command as the leader of a new process group, with the
+ * signal mask from before the forwarded ones were blocked*/
+static int	timeout_spawn(t_timeout *t, t_cmd *cmd, sigset_t *old,
+		t_shell *shell)
+{
+	t->pgrp = getpgrp();
+	t->pid = fork();
+	if (t->pid == 0)
+	{
+		setpgid(0, 0);
+		timeout_tty(t->pgrp, getpid());
+		sigprocmask(SIG_SETMASK, old, NULL);
+		child_process(cmd, -1, NULL, shell);
+	}
+	if (t->pid < 0)
+		return (1);
+	setpgid(t->pid, t->pid);
+	t->tty = timeout_tty(t->pgrp, t->pid);
+	t->fds[TO_PIDFD].fd = syscall(SYS_pidfd_open, t->pid, 0);
+	if (t->fds[TO_PIDFD].fd >= 0)
+		return (timeout_arm(t, &t->limit), 0);
+	return (timeout_abandon(t));
+}
+
+/*Polls until the pidfd says the command ended, acting on the timer;
+ * signals that came to us go on to its group. Returns the exit code*/
+static int	timeout_wait(t_timeout *t)
+{
+	struct signalfd_siginfo	si;
+	int						status;
+
+	while (!(t->fds[TO_PIDFD].revents & POLLIN))
+	{
+		if (poll(t->fds, 3, -1) < 0 && errno != EINTR)
+			break ;
+		if (t->fds[TO_TIMER].revents & POLLIN)
+			timeout_expire(t);
+		if ((t->fds[TO_SIGFD].revents & POLLIN)
+			&& read(t->fds[TO_SIGFD].fd, &si, sizeof(si)) > 0)
+			timeout_send(t, si.ssi_signo);
+	}
+	status = 0;
+	while (waitpid(t->pid, &status, 0) < 0 && errno == EINTR)
+		;
+	if (t->tty)
+		timeout_tty(tcgetpgrp(STDIN_FILENO), t->pgrp);
+	while (read(t->fds[TO_SIGFD].fd, &si, sizeof(si)) > 0)
+		;
+	if (t->expired && !t->killed)
+		return (TIMEOUT_STATUS);
+	return (report_status(status));
+}
+
+/*Runs cmd under t's limits. INT, QUIT, TERM and HUP are blocked and
+ * read from a signalfd meanwhile, to be passed on to the command's
+ * group. At a terminal that group is the foreground one and gets them
+ * first hand. Returns its exit code, 124 if time ran out, 137 if it
+ * had to be killed*/
+int	timeout_run(t_timeout *t, t_cmd *cmd, t_shell *shell)
+{
+	sigset_t	set;
+	sigset_t	old;
+	int			code;
+
+	sigemptyset(&set);
+	sigaddset(&set, SIGINT);
+	sigaddset(&set, SIGQUIT);
+	sigaddset(&set, SIGTERM);
+	sigaddset(&set, SIGHUP);
+	sigprocmask(SIG_BLOCK, &set, &old);
+	code = TIMEOUT_FAIL;
+	if (timeout_open(t, &set) || timeout_spawn(t, cmd, &old, shell))
+		perror("minishell: timeout");
+	else
+		code = timeout_wait(t);
+	sigprocmask(SIG_SETMASK, &old, NULL);
+	timeout_close(t);
+	return (code);
+}
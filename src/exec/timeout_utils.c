@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timeout_utils.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:46:38 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 12:46:38 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Signals the command's whole group. One stopped, say reading the
+ * terminal from outside the foreground group, gets SIGCONT to see it*/
+void	timeout_send(t_timeout *t, int sig)
+{
+	kill(-t->pid, sig);
+	if (sig != SIGKILL && sig != SIGCONT)
+		kill(-t->pid, SIGCONT);
+}
+
+/*Arms the timerfd for ts from now, disarms it for 0*/
+void	timeout_arm(t_timeout *t, struct timespec *ts)
+{
+	struct itimerspec	it;
+
+	ft_bzero(&it, sizeof(it));
+	it.it_value = *ts;
+	timerfd_settime(t->fds[TO_TIMER].fd, 0, &it, NULL);
+}
+
+/*Time is up: SIG to the group and the timer set for -k. Up again:
+ * SIGKILL. A command KILLed exits 137 rather than 124, as coreutils*/
+void	timeout_expire(t_timeout *t)
+{
+	uint64_t	ticks;
+
+	if (read(t->fds[TO_TIMER].fd, &ticks, sizeof(ticks)) <= 0)
+		return ;
+	if (t->expired)
+	{
+		t->killed = 1;
+		timeout_send(t, SIGKILL);
+		return ;
+	}
+	t->expired = 1;
+	t->killed = (t->sig == SIGKILL);
+	timeout_send(t, t->sig);
+	timeout_arm(t, &t->kill_after);
+}
+
+/*The timerfd and the signalfd, polled with the pidfd once the command
+ * runs. Returns 1 if one could not be made*/
+int	timeout_open(t_timeout *t, sigset_t *set)
+{
+	int	i;
+
+	t->fds[TO_PIDFD].fd = -1;
+	t->fds[TO_TIMER].fd = timerfd_create(CLOCK_MONOTONIC,
+			TFD_NONBLOCK | TFD_CLOEXEC);
+	t->fds[TO_SIGFD].fd = signalfd(-1, set, SFD_NONBLOCK | SFD_CLOEXEC);
+	i = 0;
+	while (i < 3)
+		t->fds[i++].events = POLLIN;
+	return (t->fds[TO_TIMER].fd < 0 || t->fds[TO_SIGFD].fd < 0);
+}
+
+void	timeout_close(t_timeout *t)
+{
+	int	i;
+
+	i = 0;
+	while (i < 3)
+	{
+		if (t->fds[i].fd >= 0)
+			close(t->fds[i].fd);
+		i++;
+	}
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:09:12 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:16:23 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static void	arith_error(const char *text, int err)
+{
+	static const char	*msgs[] = {"", "syntax error in expression",
+		"division by 0", "integer overflow", "value out of range",
+		"expression recursion level exceeded", "out of memory"};
+
+	ft_putstr_fd("minishell: ", 2);
+	ft_putstr_fd((char *)text, 2);
+	ft_putstr_fd(": ", 2);
+	ft_putendl_fd((char *)msgs[err], 2);
+}
+
+/*Compiled trees are kept by text in a small round robin cache, so a
+ * loop body re-expanding the same $((...)) parses it only once*/
+static t_anode	*arith_cached(t_arith *ar)
+{
+	t_arith_slot	*slot;
+	t_anode			*tree;
+	int				i;
+
+	i = -1;
+	while (++i < ARITH_CACHE_SIZE)
+	{
+		slot = &ar->shell->arith_cache[i];
+		if (slot->text && !ft_strcmp(slot->text, ar->s))
+			return (slot->tree);
+	}
+	tree = arith_compile(ar);
+	if (!tree)
+		return (NULL);
+	slot = &ar->shell->arith_cache[ar->shell->arith_next];
+	ar->shell->arith_next = (ar->shell->arith_next + 1) % ARITH_CACHE_SIZE;
+	free(slot->text);
+	arith_node_free(slot->tree);
+	slot->tree = tree;
+	slot->text = ft_strdup(ar->s);
+	if (slot->text)
+		return (tree);
+	slot->tree = NULL;
+	return (arith_fail(ar, AE_NOMEM, tree));
+}
+
+void	arith_cache_clear(t_shell *shell)
+{
+	int	i;
+
+	i = -1;
+	while (++i < ARITH_CACHE_SIZE)
+	{
+		free(shell->arith_cache[i].text);
+		arith_node_free(shell->arith_cache[i].tree);
+		shell->arith_cache[i].text = NULL;
+		shell->arith_cache[i].tree = NULL;
+	}
+	shell->arith_next = 0;
+}
+
+/*Evaluates an expression given as typed: $ constructs are expanded,
+ * then it is compiled (or found in the cache) and run.
+ * Returns 0 and the value in *res, or 1 after reporting the error*/
+int	arith_value(char *text, t_shell *shell, long long *res)
+{
+	t_arith	ar;
+	t_anode	*tree;
+	char	*expr;
+
+	expr = expand_vars(text, shell);
+	if (!expr)
+		return (1);
+	arith_init(&ar, expr, shell);
+	tree = arith_cached(&ar);
+	*res = 0;
+	if (tree)
+		*res = arith_eval(&ar, tree);
+	if (ar.err)
+		arith_error(expr, ar.err);
+	free(expr);
+	return (ar.err != AE_OK);
+}
+
+/*Replaces the $((expr)) at str[*i] by its value and moves *i past it.
+ * "$((a) ; (b))" is a command substitution of two subshells, not
+ * arithmetic. Returns NULL on error*/
+char	*expand_arith(char *str, int *i, t_shell *shell)
+{
+	char		*text;
+	long long	res;
+	int			end;
+	int			err;
+
+	end = lex_skip_group(str, *i + 1);
+	if (end < *i + 5 || str[end - 1] != ')'
+		|| lex_skip_group(str, *i + 2) != end - 1)
+		return (expand_cmdsubst(str, i, shell));
+	text = ft_substr(str, *i + 3, end - *i - 5);
+	*i = end;
+	if (!text)
+		return (NULL);
+	err = arith_value(text, shell, &res);
+	free(text);
+	if (err)
+		return (NULL);
+	return (ft_lltoa(res));
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_eval.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:09:12 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:09:12 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static long long	checked(t_arith *ar, int err, long long *res)
+{
+	if (err == AE_OK)
+		return (*res);
+	if (ar->err == AE_OK)
+		ar->err = err;
+	return (0);
+}
+
+/*&& and || only evaluate their right side when it decides the result*/
+static long long	eval_logic(t_arith *ar, t_anode *node)
+{
+	long long	lhs;
+
+	lhs = arith_eval(ar, node->a);
+	if (node->op == AR_AND && !lhs)
+		return (0);
+	if (node->op == AR_OR && lhs)
+		return (1);
+	return (arith_eval(ar, node->b) != 0);
+}
+
+/*=, op=, ++ and --: computes the new value and stores it back*/
+static long long	eval_update(t_arith *ar, t_anode *node)
+{
+	long long	old;
+	long long	val;
+	long long	step;
+
+	val = 0;
+	if (node->op == AR_ASSIGN)
+		val = arith_eval(ar, node->a);
+	old = 0;
+	if (node->op != AR_ASSIGN || node->num >= 0)
+		old = arith_var_get(ar, node->name);
+	step = 1;
+	if (node->op == AR_PREDEC || node->op == AR_POSTDEC)
+		step = -1;
+	if (node->op == AR_ASSIGN && node->num >= 0)
+		val = checked(ar, arith_apply(node->num, old, val, &val), &val);
+	else if (node->op != AR_ASSIGN)
+		val = checked(ar, arith_apply(AR_ADD, old, step, &val), &val);
+	if (ar->err)
+		return (0);
+	arith_var_set(ar, node->name, val);
+	if (node->op == AR_POSTINC || node->op == AR_POSTDEC)
+		return (old);
+	return (val);
+}
+
+long long	arith_eval(t_arith *ar, t_anode *node)
+{
+	long long	a;
+	long long	res;
+
+	if (ar->err)
+		return (0);
+	if (node->op == AR_NUM)
+		return (node->num);
+	if (node->op == AR_VAR)
+		return (arith_var_get(ar, node->name));
+	if (node->op == AR_AND || node->op == AR_OR)
+		return (eval_logic(ar, node));
+	if (node->op >= AR_PREINC && node->op <= AR_ASSIGN)
+		return (eval_update(ar, node));
+	a = arith_eval(ar, node->a);
+	if (node->op == AR_TERNARY && a)
+		return (arith_eval(ar, node->b));
+	if (node->op == AR_TERNARY)
+		return (arith_eval(ar, node->c));
+	if (node->op == AR_COMMA)
+		return (arith_eval(ar, node->b));
+	res = 0;
+	if (node->op < AR_NUM)
+		return (checked(ar, arith_apply(node->op, a,
+					arith_eval(ar, node->b), &res), &res));
+	return (checked(ar, arith_unary(node->op, a, &res), &res));
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_node.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:09:12 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:09:12 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Records err unless an earlier one is already set, frees node and
+ * returns NULL, so parse functions can bail out in one line*/
+t_anode	*arith_fail(t_arith *ar, int err, t_anode *node)
+{
+	if (ar->err == AE_OK)
+		ar->err = err;
+	arith_node_free(node);
+	return (NULL);
+}
+
+/*Node without children: constant, variable, ++/--. Takes name*/
+t_anode	*arith_leaf(t_arith *ar, t_arith_op op, long long num, char *name)
+{
+	t_anode	*node;
+
+	if (ar->err)
+		return (free(name), NULL);
+	node = ft_calloc(1, sizeof(t_anode));
+	if (!node)
+		return (free(name), arith_fail(ar, AE_NOMEM, NULL));
+	node->op = op;
+	node->num = num;
+	node->name = name;
+	return (node);
+}
+
+/*Operators whose operands are all constants are computed right away.
+ * An operation that would fail is left for the evaluation to report,
+ * since it may sit in a branch that never runs*/
+static void	fold(t_anode *node)
+{
+	long long	res;
+	int			err;
+
+	if (node->op < AR_NUM && node->a->op == AR_NUM
+		&& node->b->op == AR_NUM)
+		err = arith_apply(node->op, node->a->num, node->b->num, &res);
+	else if (node->op >= AR_NEG && node->op <= AR_BNOT
+		&& node->a->op == AR_NUM)
+		err = arith_unary(node->op, node->a->num, &res);
+	else
+		return ;
+	if (err)
+		return ;
+	arith_node_free(node->a);
+	arith_node_free(node->b);
+	node->a = NULL;
+	node->b = NULL;
+	node->op = AR_NUM;
+	node->num = res;
+}
+
+/*Operator node taking ownership of its operands. b is only required
+ * by binary operators and the comma*/
+t_anode	*arith_node(t_arith *ar, t_arith_op op, t_anode *a, t_anode *b)
+{
+	t_anode	*node;
+
+	if (ar->err || !a || (!b && (op < AR_NUM || op == AR_COMMA)))
+	{
+		arith_node_free(b);
+		return (arith_fail(ar, AE_SYNTAX, a));
+	}
+	node = arith_leaf(ar, op, 0, NULL);
+	if (!node)
+	{
+		arith_node_free(b);
+		return (arith_fail(ar, AE_NOMEM, a));
+	}
+	node->a = a;
+	node->b = b;
+	fold(node);
+	return (node);
+}
+
+void	arith_node_free(t_anode *node)
+{
+	if (!node)
+		return ;
+	arith_node_free(node->a);
+	arith_node_free(node->b);
+	arith_node_free(node->c);
+	free(node->name);
+	free(node);
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_ops.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:09:12 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:09:12 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Binary operator at s, longest match wins. Returns its length, 0 when
+ * s does not start with one, and stores the operator and precedence*/
+int	arith_binop(const char *s, t_arith_op *op, int *prec)
+{
+	static const char	*ops[] = {"||", "&&", "|", "^", "&", "==", "!=",
+		"<=", ">=", "<", ">", "<<", ">>", "+", "-", "*", "/", "%", "**"};
+	static const int	precs[] = {1, 2, 3, 4, 5, 6, 6, 7, 7, 7, 7, 8, 8,
+		9, 9, 10, 10, 10, 11};
+	int					best;
+	int					len;
+	int					i;
+
+	best = 0;
+	i = -1;
+	while (++i <= AR_POW)
+	{
+		len = ft_strlen(ops[i]);
+		if (len > best && !ft_strncmp(s, ops[i], len))
+		{
+			best = len;
+			*op = i;
+			*prec = precs[i];
+		}
+	}
+	return (best);
+}
+
+/*Square and multiply, so even huge exponents take 63 steps at most*/
+static int	arith_pow(long long a, long long b, long long *res)
+{
+	if (b < 0)
+		return (AE_RANGE);
+	*res = 1;
+	while (b > 0)
+	{
+		if ((b & 1) && __builtin_mul_overflow(*res, a, res))
+			return (AE_OVERFLOW);
+		b >>= 1;
+		if (b > 0 && __builtin_mul_overflow(a, a, &a))
+			return (AE_OVERFLOW);
+	}
+	return (AE_OK);
+}
+
+static int	arith_logic(t_arith_op op, long long a, long long b,
+		long long *res)
+{
+	if (op == AR_OR)
+		*res = (a || b);
+	else if (op == AR_AND)
+		*res = (a && b);
+	else if (op == AR_BOR)
+		*res = a | b;
+	else if (op == AR_XOR)
+		*res = a ^ b;
+	else if (op == AR_BAND)
+		*res = a & b;
+	else if (op == AR_EQ || op == AR_NE)
+		*res = ((a == b) == (op == AR_EQ));
+	else if (op == AR_LE)
+		*res = (a <= b);
+	else if (op == AR_GE)
+		*res = (a >= b);
+	else if (op == AR_LT)
+		*res = (a < b);
+	else
+		*res = (a > b);
+	return (AE_OK);
+}
+
+/*Applies a binary operator. Overflow, division by zero and shifts
+ * out of 0..63 are errors instead of wrapping or undefined behaviour.
+ * Returns AE_OK or the error*/
+int	arith_apply(t_arith_op op, long long a, long long b, long long *res)
+{
+	if (op < AR_SHL)
+		return (arith_logic(op, a, b, res));
+	if ((op == AR_DIV || op == AR_MOD) && b == 0)
+		return (AE_DIVZERO);
+	if ((op == AR_SHL || op == AR_SHR) && (b < 0 || b > 63))
+		return (AE_RANGE);
+	if ((op == AR_ADD && __builtin_add_overflow(a, b, res))
+		|| (op == AR_SUB && __builtin_sub_overflow(a, b, res))
+		|| (op == AR_MUL && __builtin_mul_overflow(a, b, res))
+		|| ((op == AR_DIV || op == AR_MOD) && a == LLONG_MIN && b == -1))
+		return (AE_OVERFLOW);
+	if (op == AR_DIV)
+		*res = a / b;
+	else if (op == AR_MOD)
+		*res = a % b;
+	else if (op == AR_SHR)
+		*res = a >> b;
+	else if (op == AR_SHL)
+		*res = (long long)((unsigned long long)a << b);
+	if (op == AR_SHL && *res >> b != a)
+		return (AE_OVERFLOW);
+	if (op == AR_POW)
+		return (arith_pow(a, b, res));
+	return (AE_OK);
+}
+
+int	arith_unary(t_arith_op op, long long a, long long *res)
+{
+	if (op == AR_NEG && a == LLONG_MIN)
+		return (AE_OVERFLOW);
+	if (op == AR_NEG)
+		*res = -a;
+	else if (op == AR_NOT)
+		*res = !a;
+	else
+		*res = ~a;
+	return (AE_OK);
+}
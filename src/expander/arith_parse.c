@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_parse.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:09:12 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:09:12 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*NAME followed by =, +=, <<= ... is an assignment, right associative.
+ * Anything else is rewound and parsed as a conditional*/
+static t_anode	*parse_assign(t_arith *ar)
+{
+	t_anode		*node;
+	char		*name;
+	long long	op;
+	int			start;
+	int			len;
+
+	arith_skip(ar);
+	start = ar->pos;
+	if (!ft_isalpha(ar->s[start]) && ar->s[start] != '_')
+		return (arith_parse_binary(ar, 0));
+	name = arith_scan_name(ar);
+	arith_skip(ar);
+	len = arith_assign_op(ar->s + ar->pos, &op);
+	if (!len || !name)
+	{
+		free(name);
+		ar->pos = start;
+		return (arith_parse_binary(ar, 0));
+	}
+	ar->pos += len;
+	node = arith_leaf(ar, AR_ASSIGN, op, name);
+	if (node)
+		node->a = parse_assign(ar);
+	return (node);
+}
+
+/*A constant condition keeps only the branch it selects*/
+static t_anode	*make_ternary(t_arith *ar, t_anode *cond, t_anode *yes,
+		t_anode *no)
+{
+	t_anode	*node;
+
+	if (!no)
+	{
+		arith_node_free(yes);
+		return (arith_fail(ar, AE_SYNTAX, cond));
+	}
+	if (cond->op == AR_NUM && cond->num)
+		return (arith_node_free(cond), arith_node_free(no), yes);
+	if (cond->op == AR_NUM)
+		return (arith_node_free(cond), arith_node_free(yes), no);
+	node = arith_node(ar, AR_TERNARY, cond, yes);
+	if (!node)
+		return (arith_fail(ar, AE_NOMEM, no));
+	node->c = no;
+	return (node);
+}
+
+/*cond ? expr : conditional, right associative*/
+static t_anode	*parse_ternary(t_arith *ar, t_anode *cond)
+{
+	t_anode	*yes;
+
+	ar->pos++;
+	yes = arith_parse(ar);
+	arith_skip(ar);
+	if (!yes || ar->s[ar->pos] != ':')
+		return (arith_node_free(yes), arith_fail(ar, AE_SYNTAX, cond));
+	ar->pos++;
+	return (make_ternary(ar, cond, yes, arith_parse_binary(ar, 0)));
+}
+
+/*Binary operators by precedence climbing. ** is the only right
+ * associative one. An operator followed by '=' is a compound
+ * assignment, which can't appear here, so it ends the operand.
+ * Level 0 also takes a trailing conditional*/
+t_anode	*arith_parse_binary(t_arith *ar, int min_prec)
+{
+	t_anode		*lhs;
+	t_arith_op	op;
+	long long	assign;
+	int			prec;
+
+	lhs = arith_parse_unary(ar);
+	while (lhs && !ar->err)
+	{
+		arith_skip(ar);
+		if (!arith_binop(ar->s + ar->pos, &op, &prec) || prec < min_prec
+			|| arith_assign_op(ar->s + ar->pos, &assign))
+			break ;
+		ar->pos += arith_binop(ar->s + ar->pos, &op, &prec);
+		lhs = arith_node(ar, op,
+				lhs, arith_parse_binary(ar, prec + (op != AR_POW)));
+	}
+	if (!lhs || ar->err || min_prec > 0 || ar->s[ar->pos] != '?')
+		return (lhs);
+	return (parse_ternary(ar, lhs));
+}
+
+/*Whole expression: assignments separated by commas*/
+t_anode	*arith_parse(t_arith *ar)
+{
+	t_anode	*node;
+
+	node = parse_assign(ar);
+	arith_skip(ar);
+	while (node && !ar->err && ar->s[ar->pos] == ',')
+	{
+		ar->pos++;
+		node = arith_node(ar, AR_COMMA, node, parse_assign(ar));
+		arith_skip(ar);
+	}
+	return (node);
+}
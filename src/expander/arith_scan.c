@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_scan.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:09:12 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:09:12 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+void	arith_init(t_arith *ar, const char *s, t_shell *shell)
+{
+	ar->s = s;
+	ar->pos = 0;
+	ar->err = AE_OK;
+	ar->depth = 0;
+	ar->shell = shell;
+}
+
+void	arith_skip(t_arith *ar)
+{
+	while (ft_isspace(ar->s[ar->pos]))
+		ar->pos++;
+}
+
+/*Integer literal: decimal, 0x hexadecimal or 0 octal*/
+t_anode	*arith_scan_number(t_arith *ar)
+{
+	const char	*s;
+	long long	val;
+	int			base;
+	int			digit;
+
+	s = ar->s;
+	base = 10 - 2 * (s[ar->pos] == '0');
+	if (base == 8 && (s[ar->pos + 1] == 'x' || s[ar->pos + 1] == 'X'))
+	{
+		base = 16;
+		ar->pos += 2;
+	}
+	val = 0;
+	while (!ar->err && ft_isalnum(s[ar->pos]))
+	{
+		digit = ft_tolower(s[ar->pos++]) - '0';
+		if (digit > 9)
+			digit += '0' - 'a' + 10;
+		if (digit < 0 || digit >= base)
+			ar->err = AE_SYNTAX;
+		else if (__builtin_mul_overflow(val, base, &val)
+			|| __builtin_add_overflow(val, digit, &val))
+			ar->err = AE_OVERFLOW;
+	}
+	return (arith_leaf(ar, AR_NUM, val, NULL));
+}
+
+/*Variable name at the parse position, malloc'd. NULL and an error
+ * set when there is none*/
+char	*arith_scan_name(t_arith *ar)
+{
+	char	*name;
+	int		start;
+
+	start = ar->pos;
+	if (ft_isalpha(ar->s[start]) || ar->s[start] == '_')
+		while (ft_isalnum(ar->s[ar->pos]) || ar->s[ar->pos] == '_')
+			ar->pos++;
+	if (ar->pos == start)
+	{
+		arith_fail(ar, AE_SYNTAX, NULL);
+		return (NULL);
+	}
+	name = ft_substr(ar->s, start, ar->pos - start);
+	if (!name)
+		arith_fail(ar, AE_NOMEM, NULL);
+	return (name);
+}
+
+/*Length of the assignment operator at s (=, +=, <<=, ...), 0 if none.
+ * *op gets the binary operator it applies, -1 for a plain =*/
+int	arith_assign_op(const char *s, long long *op)
+{
+	t_arith_op	bin;
+	int			prec;
+	int			len;
+
+	len = arith_binop(s, &bin, &prec);
+	if (len == 0 && s[0] == '=')
+	{
+		*op = -1;
+		return (1);
+	}
+	if (len == 0 || s[len] != '=' || bin <= AR_AND || bin == AR_POW
+		|| (bin >= AR_EQ && bin <= AR_GT))
+		return (0);
+	*op = bin;
+	return (len + 1);
+}
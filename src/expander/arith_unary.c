@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_unary.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:09:12 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:09:12 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*NAME, NAME++ or NAME--*/
+static t_anode	*parse_var(t_arith *ar)
+{
+	char	*name;
+	int		save;
+
+	name = arith_scan_name(ar);
+	if (!name)
+		return (NULL);
+	save = ar->pos;
+	arith_skip(ar);
+	if (ar->s[ar->pos] == '+' && ar->s[ar->pos + 1] == '+')
+	{
+		ar->pos += 2;
+		return (arith_leaf(ar, AR_POSTINC, 0, name));
+	}
+	if (ar->s[ar->pos] == '-' && ar->s[ar->pos + 1] == '-')
+	{
+		ar->pos += 2;
+		return (arith_leaf(ar, AR_POSTDEC, 0, name));
+	}
+	ar->pos = save;
+	return (arith_leaf(ar, AR_VAR, 0, name));
+}
+
+static t_anode	*parse_primary(t_arith *ar)
+{
+	t_anode	*node;
+
+	arith_skip(ar);
+	if (ft_isdigit(ar->s[ar->pos]))
+		return (arith_scan_number(ar));
+	if (ar->s[ar->pos] != '(')
+		return (parse_var(ar));
+	ar->pos++;
+	node = arith_parse(ar);
+	arith_skip(ar);
+	if (!node || ar->s[ar->pos] != ')')
+		return (arith_fail(ar, AE_SYNTAX, node));
+	ar->pos++;
+	return (node);
+}
+
+/*++NAME / --NAME. Not followed by a name, the two signs are two
+ * unary operators: --5 is 5*/
+static t_anode	*parse_preinc(t_arith *ar, char sign)
+{
+	char	*name;
+	int		save;
+
+	save = ar->pos;
+	ar->pos += 2;
+	arith_skip(ar);
+	if (!ft_isalpha(ar->s[ar->pos]) && ar->s[ar->pos] != '_')
+	{
+		ar->pos = save + 1;
+		if (sign == '+')
+			return (arith_parse_unary(ar));
+		return (arith_node(ar, AR_NEG, arith_parse_unary(ar), NULL));
+	}
+	name = arith_scan_name(ar);
+	if (sign == '+')
+		return (arith_leaf(ar, AR_PREINC, 0, name));
+	return (arith_leaf(ar, AR_PREDEC, 0, name));
+}
+
+t_anode	*arith_parse_unary(t_arith *ar)
+{
+	const char	*s;
+	t_arith_op	op;
+
+	arith_skip(ar);
+	s = ar->s + ar->pos;
+	if ((s[0] == '+' || s[0] == '-') && s[1] == s[0])
+		return (parse_preinc(ar, s[0]));
+	if (s[0] != '+' && s[0] != '-' && s[0] != '!' && s[0] != '~')
+		return (parse_primary(ar));
+	ar->pos++;
+	if (s[0] == '+')
+		return (arith_parse_unary(ar));
+	op = AR_BNOT;
+	if (s[0] == '-')
+		op = AR_NEG;
+	else if (s[0] == '!')
+		op = AR_NOT;
+	return (arith_node(ar, op, arith_parse_unary(ar), NULL));
+}
+
+/*Parses a whole expression, which must be used up entirely.
+ * An empty expression is 0. Whatever was built is dropped on error*/
+t_anode	*arith_compile(t_arith *ar)
+{
+	t_anode	*tree;
+
+	arith_skip(ar);
+	if (!ar->s[ar->pos])
+		return (arith_leaf(ar, AR_NUM, 0, NULL));
+	tree = arith_parse(ar);
+	arith_skip(ar);
+	if (tree && (ar->err || ar->s[ar->pos]))
+		return (arith_fail(ar, AE_SYNTAX, tree));
+	return (tree);
+}
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_var.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:09:13 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:09:13 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Unset or empty is 0. A value that is not a plain integer is itself
+ * evaluated as an expression, like sh does, up to ARITH_MAX_DEPTH*/
+long long	arith_var_get(t_arith *ar, char *name)
+{
+	t_arith		sub;
+	t_anode		*tree;
+	char		*value;
+	long long	res;
+
+	value = get_env_value(ar->shell->env_vars, name);
+	if (ar->err || !value || !*value)
+		return (0);
+	if (!ft_atoll_overflow(value, &res))
+		return (res);
+	if (ar->depth >= ARITH_MAX_DEPTH)
+		return (arith_fail(ar, AE_DEPTH, NULL), 0);
+	arith_init(&sub, value, ar->shell);
+	sub.depth = ar->depth + 1;
+	tree = arith_compile(&sub);
+	res = 0;
+	if (tree)
+		res = arith_eval(&sub, tree);
+	arith_node_free(tree);
+	if (sub.err)
+		return (arith_fail(ar, sub.err, NULL), 0);
+	return (res);
+}
+
+void	arith_var_set(t_arith *ar, char *name, long long val)
+{
+	char	*num;
+	char	*key;
+	char	*assign;
+
+	num = ft_lltoa(val);
+	key = NULL;
+	if (num)
+		key = ft_strjoin(name, "=");
+	assign = NULL;
+	if (key)
+		assign = ft_strjoin(key, num);
+	free(num);
+	free(key);
+	if (!assign)
+	{
+		arith_fail(ar, AE_NOMEM, NULL);
+		return ;
+	}
+	update_env(assign, &ar->shell->env_vars);
+	free(assign);
+}
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   brace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:18:07 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:18:07 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Index past the element at raw[i]: quoted sections and $(...) ${...}
+ * groups are skipped whole, braces in them are never expanded*/
+int	brace_next(char *raw, int i)
+{
+	if (raw[i] == '\'' || raw[i] == '"')
+		return (lex_skip_quote(raw, i));
+	if (raw[i] == '$' && (raw[i + 1] == '(' || raw[i + 1] == '{'))
+		return (lex_skip_group(raw, i + 1));
+	return (i + 1);
+}
+
+/*Index of the '}' closing the '{' at raw[i], -1 if none. *comma tells
+ * whether a ',' sits at the top level of the group*/
+static int	brace_close(char *raw, int i, int *comma)
+{
+	int	depth;
+
+	depth = 0;
+	*comma = 0;
+	while (raw[i])
+	{
+		if (raw[i] == '{')
+			depth++;
+		else if (raw[i] == '}' && --depth == 0)
+			return (i);
+		else if (raw[i] == ',' && depth == 1)
+			*comma = 1;
+		i = brace_next(raw, i);
+	}
+	return (-1);
+}
+
+/*First group worth expanding: a list {a,b} (returns 1) or a range
+ * {x..y[..s]} (returns 2). Any other '{' is literal. 0 when none*/
+static int	brace_find(char *raw, int *span, t_range *r)
+{
+	int	comma;
+	int	i;
+
+	i = 0;
+	while (raw[i])
+	{
+		if (raw[i] == '{')
+		{
+			span[0] = i;
+			span[1] = brace_close(raw, i, &comma);
+			if (span[1] > 0 && comma)
+				return (1);
+			if (span[1] > 0
+				&& brace_range_parse(raw + i + 1, span[1] - i - 1, r))
+				return (2);
+		}
+		i = brace_next(raw, i);
+	}
+	return (0);
+}
+
+/*br->word holds what is already decided, raw the rest of the word.
+ * The first group of raw is expanded and each result walked again,
+ * depth first, so words reach the argv in order and one at a time*/
+int	brace_walk(t_brace *br, char *raw)
+{
+	t_range	r;
+	size_t	base;
+	int		span[2];
+	int		kind;
+	int		err;
+
+	base = br->word.len;
+	kind = brace_find(raw, span, &r);
+	if (!kind)
+		err = (buf_append(&br->word, raw, ft_strlen(raw))
+				|| expand_to_argv(br->word.data, br->av, br->shell));
+	else if (buf_append(&br->word, raw, span[0]))
+		err = 1;
+	else if (kind == 1)
+		err = brace_list(br, raw, span[0], span[1]);
+	else
+		err = brace_range(br, &r, raw + span[1] + 1);
+	br->word.len = base;
+	if (br->word.data)
+		br->word.data[base] = '\0';
+	return (err);
+}
+
+/*Brace expansion, the first word expansion stage. Every word it makes
+ * goes through the other stages and lands in av; nothing is collected
+ * in between. Assignments are left alone*/
+int	expand_braces(char *raw, t_argv *av, t_shell *shell)
+{
+	t_brace	br;
+	int		err;
+
+	if (!ft_strchr(raw, '{') || is_right_assignment(raw))
+		return (expand_to_argv(raw, av, shell));
+	buf_init(&br.word);
+	br.av = av;
+	br.shell = shell;
+	err = brace_walk(&br, raw);
+	buf_free(&br.word);
+	return (err);
+}
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   brace_list.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:18:07 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:18:07 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Walks one alternative followed by the rest of the word. They are
+ * joined because the alternative may hold groups of its own*/
+static int	brace_alt(t_brace *br, char *alt, int len, char *rest)
+{
+	char	*word;
+	size_t	rest_len;
+	int		err;
+
+	rest_len = ft_strlen(rest);
+	word = malloc(len + rest_len + 1);
+	if (!word)
+		return (1);
+	ft_memcpy(word, alt, len);
+	ft_memcpy(word + len, rest, rest_len + 1);
+	err = brace_walk(br, word);
+	free(word);
+	return (err);
+}
+
+/*{a,b,...} at raw[open..close]: top level commas split it*/
+int	brace_list(t_brace *br, char *raw, int open, int close)
+{
+	int	start;
+	int	depth;
+	int	i;
+
+	i = open + 1;
+	start = i;
+	depth = 0;
+	while (i <= close)
+	{
+		if (i == close || (raw[i] == ',' && depth == 0))
+		{
+			if (brace_alt(br, raw + start, i - start, raw + close + 1))
+				return (1);
+			start = i + 1;
+		}
+		depth += (raw[i] == '{') - (raw[i] == '}');
+		i = brace_next(raw, i);
+	}
+	return (0);
+}
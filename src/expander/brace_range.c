@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   brace_range.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:18:07 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:18:07 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Integer at s[*i]. A leading zero asks for zero padding to the width
+ * of the number as written, kept in *width when wider*/
+static int	range_int(char *s, int *i, long long *v, int *width)
+{
+	int	start;
+	int	digits;
+
+	start = *i;
+	if (s[*i] == '-' || s[*i] == '+')
+		(*i)++;
+	digits = *i;
+	*v = 0;
+	while (ft_isdigit(s[*i]) && *i - digits < 18)
+		*v = *v * 10 + (s[(*i)++] - '0');
+	if (*i == digits || ft_isdigit(s[*i]))
+		return (0);
+	if (s[start] == '-')
+		*v = -*v;
+	if (width && s[digits] == '0' && *i - digits > 1 && *i - start > *width)
+		*width = *i - start;
+	return (1);
+}
+
+/*x..y where both ends are integers or both single letters*/
+static int	range_ends(char *s, int *i, t_range *r)
+{
+	if (ft_isalpha(s[0]) && s[1] == '.' && s[2] == '.'
+		&& ft_isalpha(s[3]))
+	{
+		r->letters = 1;
+		r->from = s[0];
+		r->to = s[3];
+		*i = 4;
+		return (1);
+	}
+	if (!range_int(s, i, &r->from, &r->width)
+		|| s[*i] != '.' || s[*i + 1] != '.')
+		return (0);
+	*i += 2;
+	return (range_int(s, i, &r->to, &r->width));
+}
+
+/*Parses the len bytes of s, the inside of {x..y} or {x..y..step}.
+ * The step sign is ignored: the range always walks from x to y*/
+int	brace_range_parse(char *s, int len, t_range *r)
+{
+	long long	step;
+	int			i;
+
+	ft_bzero(r, sizeof(t_range));
+	i = 0;
+	if (!range_ends(s, &i, r))
+		return (0);
+	step = 1;
+	if (i < len && s[i] == '.' && s[i + 1] == '.')
+	{
+		i += 2;
+		if (!range_int(s, &i, &step, NULL))
+			return (0);
+	}
+	if (i != len)
+		return (0);
+	if (step < 0)
+		step = -step;
+	if (step == 0)
+		step = 1;
+	r->step = step;
+	if (r->from > r->to)
+		r->step = -step;
+	return (1);
+}
+
+/*One value of the range into out, zero padded to r->width*/
+static void	range_fmt(t_range *r, long long v, char *out)
+{
+	unsigned long long	u;
+	unsigned long long	t;
+	int					len;
+	int					i;
+
+	out[0] = (char)v;
+	out[1] = '\0';
+	if (r->letters)
+		return ;
+	i = (v < 0);
+	out[0] = '-';
+	u = llabs(v);
+	t = u;
+	len = 1;
+	while (t >= 10 && ++len)
+		t /= 10;
+	while (i + len < r->width)
+		out[i++] = '0';
+	out[i + len] = '\0';
+	while (len-- > 0)
+	{
+		out[i + len] = '0' + u % 10;
+		u /= 10;
+	}
+}
+
+/*Values are made one at a time into a small buffer and walked with the
+ * rest of the word, so {1..1000000} never exists as a list*/
+int	brace_range(t_brace *br, t_range *r, char *rest)
+{
+	char		num[32];
+	long long	v;
+	size_t		base;
+
+	base = br->word.len;
+	v = r->from;
+	while ((r->step > 0 && v <= r->to) || (r->step < 0 && v >= r->to))
+	{
+		range_fmt(r, v, num);
+		if (buf_append(&br->word, num, ft_strlen(num))
+			|| brace_walk(br, rest))
+			return (1);
+		br->word.len = base;
+		if (__builtin_add_overflow(v, r->step, &v))
+			break ;
+	}
+	return (0);
+}
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmdsubst.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:05:10 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:14:11 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*$(< file): the file is read straight into the result, no child.
+ * The size is reserved up front so regular files take one read()*/
+static int	subst_file(char *word, t_buf *out, t_shell *shell)
+{
+	t_wexp		ex;
+	struct stat	st;
+	int			fd;
+
+	wexp_init(&ex, shell);
+	if (expand_word(word, &ex) || buf_reserve(&ex.out, 0))
+		return (buf_free(&ex.out), 1);
+	fd = open(ex.out.data, O_RDONLY | O_CLOEXEC);
+	shell->exit_code = 0;
+	if (fd < 0 || (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)
+			&& buf_reserve(out, st.st_size)) || read_all(fd, out))
+	{
+		ft_putstr_fd("minishell: ", 2);
+		perror(ex.out.data);
+		shell->exit_code = 1;
+	}
+	if (fd >= 0)
+		close(fd);
+	buf_free(&ex.out);
+	return (0);
+}
+
+/*Builtins that only print can run in our own process: nothing they
+ * do outlives the substitution the way cd, export or exit would. Not
+ * when a function of the same name hides the builtin. cat only with
+ * files to read, it would read our stdin else*/
+static int	subst_is_printer(t_cmd *cmd, t_shell *shell)
+{
+	if (cmd->next || cmd->redirs || !cmd->words || !cmd->words[0]
+		|| func_find(shell, cmd->words[0]))
+		return (0);
+	if (!ft_strcmp(cmd->words[0], "echo")
+		|| !ft_strcmp(cmd->words[0], "pwd"))
+		return (1);
+	if (!ft_strcmp(cmd->words[0], "cat"))
+		return (cmd->words[1] && cat_is_plain(cmd->words));
+	return (!ft_strcmp(cmd->words[0], "env") && !cmd->words[1]);
+}
+
+/*Runs the builtin with stdout on an anonymous file, then reads back
+ * what it wrote. Falls back to a child if stdout can't be moved, or if
+ * the words expanded to something else*/
+static int	subst_builtin(t_cmd *cmd, char *inner, t_buf *out,
+		t_shell *shell)
+{
+	int	fd;
+	int	saved;
+
+	if (expand_cmd(cmd, shell))
+		return (1);
+	fd = -1;
+	if (is_builtin(cmd->args)
+		&& (cmd->args[1] || ft_strcmp(cmd->args[0], "cat")))
+		fd = anon_file("minishell-subst");
+	saved = -1;
+	if (fd >= 0)
+		saved = dup(STDOUT_FILENO);
+	if (saved < 0 || dup2(fd, STDOUT_FILENO) < 0)
+	{
+		close(fd);
+		close(saved);
+		return (cmdsubst_fork(inner, out, shell));
+	}
+	shell->exit_code = exec_builtin(cmd, shell);
+	dup2(saved, STDOUT_FILENO);
+	close(saved);
+	saved = lseek(fd, 0, SEEK_SET) < 0 || read_all(fd, out);
+	close(fd);
+	return (saved);
+}
+
+static int	subst_run(char *inner, t_buf *out, t_shell *shell)
+{
+	t_token	*tokens;
+	t_node	*tree;
+	int		ret;
+
+	tokens = lexer(inner);
+	if (tokens && tokens->type == TK_REDIR_IN && tokens->next
+		&& tokens->next->type == TK_WORD && !tokens->next->next)
+	{
+		ret = subst_file(tokens->next->value, out, shell);
+		return (free_tokens(tokens), ret);
+	}
+	tree = parser(tokens, shell, NULL);
+	ret = 0;
+	if (tree && tree->type == ND_PIPELINE
+		&& subst_is_printer(tree->cmds, shell))
+		ret = subst_builtin(tree->cmds, inner, out, shell);
+	else if (tree)
+		ret = cmdsubst_fork(inner, out, shell);
+	free_tree(tree);
+	free_tokens(tokens);
+	return (ret);
+}
+
+/*Replaces the $(...) at str[*i] by the output of the command with
+ * trailing newlines removed, and moves *i past it.
+ * Returns NULL only on malloc failure*/
+char	*expand_cmdsubst(char *str, int *i, t_shell *shell)
+{
+	t_buf	out;
+	char	*inner;
+	int		end;
+	int		err;
+
+	end = lex_skip_group(str, *i + 1);
+	inner = ft_substr(str, *i + 2, end - *i - 2 - (str[end - 1] == ')'));
+	*i = end;
+	if (!inner)
+		return (NULL);
+	buf_init(&out);
+	err = subst_run(inner, &out, shell);
+	shell->substs++;
+	free(inner);
+	if (err)
+		return (buf_free(&out), NULL);
+	while (out.len > 0 && out.data[out.len - 1] == '\n')
+		out.len--;
+	return (buf_release(&out));
+}
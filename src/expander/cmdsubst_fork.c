@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmdsubst_fork.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:05:11 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:42:23 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Child side: stdout is the pipe and the inner text runs like any
+ * other command line*/
+static void	subst_child(char *inner, int *fds, t_shell *shell)
+{
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+	dup2(fds[1], STDOUT_FILENO);
+	close(fds[0]);
+	close(fds[1]);
+	procsub_release(shell, 0);
+	free_tokens(shell->s_tokens);
+	shell->s_tokens = NULL;
+	free_tree(shell->s_tree);
+	shell->s_tree = NULL;
+	shell->s_cmds = NULL;
+	process_line(inner, shell, NULL);
+	cleanup_exit_child(shell, shell->exit_code);
+}
+
+/*Runs inner in a child and collects its stdout through a pipe, in
+ * large reads straight into out. $? becomes the child's status*/
+int	cmdsubst_fork(char *inner, t_buf *out, t_shell *shell)
+{
+	struct sigaction	old[2];
+	pid_t				pid;
+	int					fds[2];
+	int					status;
+	int					err;
+
+	if (pipe2(fds, O_CLOEXEC) < 0)
+		return (perror("minishell: command substitution"), 0);
+	swap_job_signals(old, 0);
+	pid = fork();
+	if (pid == 0)
+		subst_child(inner, fds, shell);
+	close(fds[1]);
+	err = 0;
+	if (pid < 0)
+		perror("minishell: fork");
+	else
+		err = read_all(fds[0], out);
+	close(fds[0]);
+	status = 1 << 8;
+	while (pid > 0 && waitpid(pid, &status, 0) < 0 && errno == EINTR)
+		;
+	swap_job_signals(old, 1);
+	shell->exit_code = exit_status_of(status);
+	return (err);
+}
@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expand_cmd.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:01:14 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:25:24 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*One word can give zero or more arguments once split and matched
+ * against pathnames. Assignments (NAME=...) are never split nor matched*/
+int	expand_to_argv(char *raw, t_argv *av, t_shell *shell)
+{
+	t_wexp	ex;
+
+	wexp_init(&ex, shell);
+	if (!is_right_assignment(raw))
+	{
+		ex.fields = av;
+		ex.pattern = !env_flag(shell->env_vars, "MINISHELL_NOGLOB");
+	}
+	if (expand_word(raw, &ex))
+		return (buf_free(&ex.out), 1);
+	return (wexp_field_end(&ex, av));
+}
+
+/*Heredoc delimiters are never expanded, every other target is*/
+static int	expand_redirs(t_redir *redir, t_shell *shell)
+{
+	t_wexp	ex;
+
+	while (redir)
+	{
+		if (redir->type != REDIR_HEREDOC && redir->target)
+		{
+			wexp_init(&ex, shell);
+			if (expand_word(redir->target, &ex))
+				return (buf_free(&ex.out), 1);
+			free(redir->file);
+			redir->file = buf_release(&ex.out);
+		}
+		redir = redir->next;
+	}
+	return (0);
+}
+
+/*Rebuilds cmd->args and the redirection files from the words as typed.
+ * Runs right before the command starts, each time it starts*/
+int	expand_cmd(t_cmd *cmd, t_shell *shell)
+{
+	t_argv	av;
+	int		i;
+
+	free_tab(cmd->args);
+	cmd->args = NULL;
+	ft_bzero(&av, sizeof(t_argv));
+	i = 0;
+	while (cmd->words && cmd->words[i])
+	{
+		if (expand_braces(cmd->words[i++], &av, shell))
+			return (free_tab(av.v), 1);
+	}
+	cmd->args = av.v;
+	return (expand_redirs(cmd->redirs, shell));
+}
+
+int	expand_pipeline(t_cmd *cmds, t_shell *shell)
+{
+	while (cmds)
+	{
+		if (expand_cmd(cmds, shell))
+			return (1);
+		cmds = cmds->next;
+	}
+	return (0);
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expand_fields.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:04:40 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:25:24 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Closes the field being built and pushes it to av, through pathname
+ * expansion when it was built as a pattern. A field that is empty is
+ * dropped unless it had quotes: $EMPTY disappears, "" and "$EMPTY" stay
+ * as empty arguments. Returns 1 on error*/
+int	wexp_field_end(t_wexp *ex, t_argv *av)
+{
+	char	*field;
+
+	if (ex->out.len == 0 && !ex->quoted)
+	{
+		buf_free(&ex->out);
+		return (0);
+	}
+	ex->quoted = 0;
+	field = buf_release(&ex->out);
+	if (!field)
+		return (1);
+	if (ex->pattern)
+		return (glob_field(field, av, ex->shell));
+	return (argv_push(av, field));
+}
+
+/*Appends an unquoted expansion result, cutting a new field at every
+ * run of $IFS characters (space, tab and newline when unset)*/
+int	wexp_split(t_wexp *ex, char *value)
+{
+	char	*ifs;
+	size_t	len;
+
+	ifs = get_env_value(ex->shell->env_vars, "IFS");
+	if (!ifs)
+		ifs = IFS_DEFAULT;
+	while (*value)
+	{
+		len = 0;
+		while (value[len] && !ft_strchr(ifs, value[len]))
+			len++;
+		if (wexp_unquoted(ex, value, len))
+			return (1);
+		value += len;
+		if (!*value)
+			break ;
+		if (wexp_field_end(ex, ex->fields))
+			return (1);
+		while (*value && ft_strchr(ifs, *value))
+			value++;
+	}
+	return (0);
+}
+
+/*Appends src with the bytes of set escaped by a '\'*/
+static int	wexp_escaped(t_wexp *ex, const char *src, size_t n,
+	const char *set)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < n)
+	{
+		if (ft_strchr(set, src[i])
+			&& buf_append(&ex->out, "\\", 1))
+			return (1);
+		if (buf_append(&ex->out, src + i++, 1))
+			return (1);
+	}
+	return (0);
+}
+
+/*Appends quoted text. In a pattern its * ? [ and \ are escaped so
+ * the matcher takes them literally*/
+int	wexp_quoted(t_wexp *ex, const char *src, size_t n)
+{
+	if (!ex->pattern)
+		return (buf_append(&ex->out, src, n));
+	return (wexp_escaped(ex, src, n, "*?[\\"));
+}
+
+/*Appends unquoted text, whose glob characters stay active. The lexer
+ * gives '\' no meaning, so in a pattern it is escaped to stay as typed*/
+int	wexp_unquoted(t_wexp *ex, const char *src, size_t n)
+{
+	if (!ex->pattern)
+		return (buf_append(&ex->out, src, n));
+	return (wexp_escaped(ex, src, n, "\\"));
+}
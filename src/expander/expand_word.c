@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expand_word.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:01:14 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:49:25 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+void	wexp_init(t_wexp *ex, t_shell *shell)
+{
+	buf_init(&ex->out);
+	ex->quoted = 0;
+	ex->fields = NULL;
+	ex->pattern = 0;
+	ex->shell = shell;
+}
+
+/*Results outside double quotes go through field splitting*/
+static int	exp_dollar(char *raw, int i, t_wexp *ex, int quoted)
+{
+	char	*value;
+	int		err;
+
+	value = expand_dollar(raw, &i, ex->shell);
+	if (!value)
+		return (-1);
+	if (quoted)
+		err = wexp_quoted(ex, value, ft_strlen(value));
+	else if (ex->fields)
+		err = wexp_split(ex, value);
+	else
+		err = wexp_unquoted(ex, value, ft_strlen(value));
+	free(value);
+	if (err)
+		return (-1);
+	return (i);
+}
+
+/*'...': everything up to the closing quote is literal*/
+static int	exp_squote(char *raw, int i, t_wexp *ex)
+{
+	int	start;
+
+	ex->quoted = 1;
+	start = ++i;
+	while (raw[i] && raw[i] != '\'')
+		i++;
+	if (wexp_quoted(ex, raw + start, i - start))
+		return (-1);
+	if (raw[i])
+		i++;
+	return (i);
+}
+
+/*"...": literal apart from $ expansions. "$@" may still give several
+ * fields*/
+static int	exp_dquote(char *raw, int i, t_wexp *ex)
+{
+	ex->quoted = 1;
+	i++;
+	while (i >= 0 && raw[i] && raw[i] != '"')
+	{
+		if (raw[i] == '$' && raw[i + 1] == '@' && ex->fields)
+			i = wexp_params(ex, i);
+		else if (raw[i] == '$' && raw[i + 1] && raw[i + 1] != '"')
+			i = exp_dollar(raw, i, ex, 1);
+		else if (wexp_quoted(ex, &raw[i++], 1))
+			i = -1;
+	}
+	if (i >= 0 && raw[i])
+		i++;
+	return (i);
+}
+
+/*Expands one word as typed into ex->out: a leading <(...) or >(...),
+ * quote removal and $ expansions. Returns 1 on error*/
+int	expand_word(char *raw, t_wexp *ex)
+{
+	int	i;
+
+	i = 0;
+	if ((raw[0] == '<' || raw[0] == '>') && raw[1] == '(')
+		i = expand_procsub(raw, 0, ex);
+	while (i >= 0 && raw[i])
+	{
+		if (raw[i] == '\'')
+			i = exp_squote(raw, i, ex);
+		else if (raw[i] == '"')
+			i = exp_dquote(raw, i, ex);
+		else if (raw[i] == '$' && raw[i + 1])
+			i = exp_dollar(raw, i, ex, 0);
+		else if (wexp_unquoted(ex, &raw[i++], 1))
+			i = -1;
+	}
+	return (i < 0);
+}
@@ -6,7 +6,7 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/01 03:15:10 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/02/02 13:54:11 by abroslav         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:49:25 by abroslav         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -42,68 +42,51 @@ static char	*expand_var_name(char *str, int *i, char **env)
 	return (free(var_name), var_value);
 }
 
-static char	*extract_and_expand_var(char *str, int *i, char **env,
-		int last_exit)
+/*Expands the $ construct at str[*i] ($NAME, $?, $1, $#, $@, $(cmd),
+ * $((expr)), ${...}) and moves *i past it.
+ * Returns a malloc'd string, "" for unset variables*/
+char	*expand_dollar(char *str, int *i, t_shell *shell)
 {
+	if (str[*i + 1] == '(' && str[*i + 2] == '(')
+		return (expand_arith(str, i, shell));
+	if (str[*i + 1] == '(')
+		return (expand_cmdsubst(str, i, shell));
+	if (str[*i + 1] == '{')
+		return (expand_param(str, i, shell));
 	(*i)++;
-	if (str[*i] == '?' || str[*i] == '$')
-	{
-		return (special_expand_params(str[(*i)++], last_exit));
-	}
+	if (str[*i] && ft_strchr("?$#@*0123456789", str[*i]))
+		return (special_expand_params(str[(*i)++], shell));
 	if (!str[*i] || (!ft_isalnum(str[*i]) && str[*i] != '_'))
 		return (ft_strdup("$"));
-	if (ft_isdigit(str[*i]))
-	{
-		(*i)++;
-		return (ft_strdup(""));
-	}
-	return (expand_var_name(str, i, env));
+	return (expand_var_name(str, i, shell->env_vars));
 }
 
-char	*expand_vars(char *str, char **env, int last_exit)
+/*$ expansion over a whole string with no quote handling (heredoc
+ * bodies). Literal runs are copied in one go, not char by char*/
+char	*expand_vars(char *str, t_shell *shell)
 {
-	char	*result;
-	char	*var_value;
-	char	tmp[2];
+	t_buf	out;
+	char	*value;
+	int		start;
 	int		i;
 
 	if (!str)
 		return (NULL);
-	result = ft_strdup("");
+	buf_init(&out);
 	i = 0;
 	while (str[i])
 	{
-		if (str[i] == '$' && str[i + 1])
-		{
-			var_value = extract_and_expand_var(str, &i, env, last_exit);
-			result = join_and_free(result, var_value);
-		}
-		else
-		{
-			tmp[0] = str[i];
-			tmp[1] = '\0';
-			result = join_and_free(result, ft_strdup(tmp));
+		start = i;
+		while (str[i] && !(str[i] == '$' && str[i + 1]))
 			i++;
-		}
-	}
-	return (result);
-}
-
-void	expand_tokens(t_token *tokens, char **env, int last_exit)
-{
-	char	*expanded;
-
-	while (tokens)
-	{
-		if (tokens->type == TK_WORD && !tokens->no_expand)
-		{
-			expanded = expand_vars(tokens->value, env, last_exit);
-			if (expanded)
-			{
-				free(tokens->value);
-				tokens->value = expanded;
-			}
-		}
-		tokens = tokens->next;
+		if (buf_append(&out, str + start, i - start))
+			return (buf_free(&out), NULL);
+		if (!str[i])
+			break ;
+		value = expand_dollar(str, &i, shell);
+		if (!value || buf_append(&out, value, ft_strlen(value)))
+			return (free(value), buf_free(&out), NULL);
+		free(value);
 	}
+	return (buf_release(&out));
 }
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:14:10 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:49:25 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Length of the parameter name at s: ? and $, positional digits or an
+ * identifier. 0 when there is none*/
+static int	param_name_len(char *s)
+{
+	int	len;
+
+	if (s[0] == '?' || s[0] == '$')
+		return (1);
+	len = 0;
+	if (ft_isdigit(s[0]))
+	{
+		while (ft_isdigit(s[len]))
+			len++;
+	}
+	else if (ft_isalpha(s[0]) || s[0] == '_')
+	{
+		while (ft_isalnum(s[len]) || s[len] == '_')
+			len++;
+	}
+	return (len);
+}
+
+/*malloc'd value, NULL when unset. Positional parameters past $# are
+ * unset*/
+static char	*param_get(char *name, t_shell *shell)
+{
+	char	*value;
+
+	if (name[0] == '?' || name[0] == '$')
+		return (special_expand_params(name[0], shell));
+	if (ft_isdigit(name[0]))
+		value = positional_get(shell, ft_atoi(name));
+	else
+		value = get_env_value(shell->env_vars, name);
+	if (!value)
+		return (NULL);
+	return (ft_strdup(value));
+}
+
+static char	*param_apply(t_param *pm, int count)
+{
+	char	*op;
+
+	op = pm->op;
+	if (count && pm->value)
+		return (ft_lltoa(ft_strlen(pm->value)));
+	if (count)
+		return (ft_strdup("0"));
+	if (!*op && pm->value)
+		return (ft_strdup(pm->value));
+	if (!*op)
+		return (ft_strdup(""));
+	if (op[0] == ':' && op[1] && ft_strchr("-=+?", op[1]))
+		return (param_default(pm, op + 1, 1));
+	if (ft_strchr("-=+?", op[0]))
+		return (param_default(pm, op, 0));
+	if (op[0] == ':')
+		return (param_substr(pm, op + 1));
+	if (op[0] == '#' || op[0] == '%')
+		return (param_strip(pm));
+	if (op[0] == '/')
+		return (param_replace(pm));
+	return (param_error(pm, "bad substitution"));
+}
+
+/*${#NAME} is the length, any other form is NAME and an operator*/
+static char	*param_eval(t_param *pm)
+{
+	char	*res;
+	int		count;
+
+	count = (pm->inner[0] == '#' && pm->inner[1]);
+	pm->name = ft_substr(pm->inner, count,
+			param_name_len(pm->inner + count));
+	if (!pm->name)
+		return (NULL);
+	pm->op = pm->inner + count + ft_strlen(pm->name);
+	if (!pm->name[0] || (count && *pm->op))
+		res = param_error(pm, "bad substitution");
+	else
+	{
+		pm->value = param_get(pm->name, pm->shell);
+		res = param_apply(pm, count);
+		free(pm->value);
+	}
+	free(pm->name);
+	return (res);
+}
+
+/*Replaces the ${...} at str[*i] and moves *i past it.
+ * Returns NULL on error, after reporting it*/
+char	*expand_param(char *str, int *i, t_shell *shell)
+{
+	t_param	pm;
+	char	*res;
+	int		end;
+
+	end = lex_skip_group(str, *i + 1);
+	pm.inner = ft_substr(str, *i + 2, end - *i - 2 - (str[end - 1] == '}'));
+	*i = end;
+	if (!pm.inner)
+		return (NULL);
+	pm.shell = shell;
+	pm.value = NULL;
+	res = NULL;
+	if (str[end - 1] != '}')
+		param_error(&pm, "bad substitution");
+	else
+		res = param_eval(&pm);
+	free(pm.inner);
+	return (res);
+}
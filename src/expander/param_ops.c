@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_ops.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:14:10 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:14:10 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+char	*param_error(t_param *pm, char *msg)
+{
+	ft_putstr_fd("minishell: ${", 2);
+	ft_putstr_fd(pm->inner, 2);
+	ft_putstr_fd("}: ", 2);
+	ft_putendl_fd(msg, 2);
+	return (NULL);
+}
+
+/*Expands the word of an operator, never split. In a pattern the
+ * quoted parts are escaped for glob_match()*/
+char	*param_word(t_param *pm, char *raw, int pattern)
+{
+	t_wexp	ex;
+
+	wexp_init(&ex, pm->shell);
+	ex.pattern = pattern;
+	if (expand_word(raw, &ex))
+	{
+		buf_free(&ex.out);
+		return (NULL);
+	}
+	return (buf_release(&ex.out));
+}
+
+/*${NAME=word}: word also becomes the value of NAME*/
+static char	*param_assign(t_param *pm, char *word)
+{
+	char	*key;
+	char	*assign;
+
+	if (!ft_isalpha(pm->name[0]) && pm->name[0] != '_')
+		return (free(word), param_error(pm, "cannot assign in this way"));
+	key = ft_strjoin(pm->name, "=");
+	assign = NULL;
+	if (key)
+		assign = ft_strjoin(key, word);
+	free(key);
+	if (!assign)
+		return (free(word), NULL);
+	update_env(assign, &pm->shell->env_vars);
+	free(assign);
+	return (word);
+}
+
+/*${NAME-w} ${NAME=w} ${NAME+w} ${NAME?w}: without the ':' only an
+ * unset NAME counts as missing, with it an empty one does too.
+ * The word is only expanded when it is used*/
+char	*param_default(t_param *pm, char *op, int colon)
+{
+	char	*word;
+	int		missing;
+
+	missing = (!pm->value || (colon && !pm->value[0]));
+	if (op[0] == '+' && missing)
+		return (ft_strdup(""));
+	if (op[0] != '+' && !missing)
+		return (ft_strdup(pm->value));
+	word = param_word(pm, op + 1, 0);
+	if (!word || op[0] == '-' || op[0] == '+')
+		return (word);
+	if (op[0] == '=')
+		return (param_assign(pm, word));
+	ft_putstr_fd("minishell: ", 2);
+	ft_putstr_fd(pm->name, 2);
+	ft_putstr_fd(": ", 2);
+	if (!word[0])
+		ft_putendl_fd("parameter null or not set", 2);
+	else
+		ft_putendl_fd(word, 2);
+	free(word);
+	return (NULL);
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_replace.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:15:07 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:15:36 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Length of the longest non-empty match of pat at the start of the n
+ * bytes of v, 0 when none. Patterns without '*' can only match one
+ * length, which is the only one tried; the others take one forward
+ * scan*/
+static size_t	match_at(const char *pat, const char *v, size_t n)
+{
+	ssize_t	fixed;
+
+	if (!*pat)
+		return (0);
+	fixed = glob_fixed_len(pat);
+	if (fixed >= 0)
+	{
+		if (fixed > 0 && (size_t)fixed <= n && glob_match(pat, v, fixed))
+			return (fixed);
+		return (0);
+	}
+	fixed = glob_prefix(pat, v, n);
+	if (fixed < 0)
+		return (0);
+	return (fixed);
+}
+
+/*pr holds the pattern and its replacement. A value the pattern matches
+ * nowhere in is copied as is. A pattern starting with '*' that matches
+ * nowhere from i cannot match anywhere after i either*/
+static int	replace_into(t_buf *out, const char *v, char **pr, int all)
+{
+	size_t	n;
+	size_t	i;
+	size_t	len;
+
+	n = ft_strlen(v);
+	if (!glob_found(pr[0], v, n))
+		return (buf_append(out, v, n));
+	i = 0;
+	while (i < n)
+	{
+		len = match_at(pr[0], v + i, n - i);
+		if (len == 0 && pr[0][0] == '*')
+			return (buf_append(out, v + i, n - i));
+		if (len == 0 && buf_append(out, v + i++, 1))
+			return (1);
+		if (len == 0)
+			continue ;
+		if (buf_append(out, pr[1], ft_strlen(pr[1])))
+			return (1);
+		i += len;
+		if (!all)
+			return (buf_append(out, v + i, n - i));
+	}
+	return (0);
+}
+
+/*Cuts "pat/rep" at the first '/' outside quotes and $ groups, then
+ * expands both halves. Returns 1 on error*/
+static int	split_replace(t_param *pm, char *raw, char **pr)
+{
+	char	*pat;
+	int		i;
+
+	i = 0;
+	while (raw[i] && raw[i] != '/')
+	{
+		if (raw[i] == '\'' || raw[i] == '"')
+			i = lex_skip_quote(raw, i);
+		else if (raw[i] == '$' && (raw[i + 1] == '(' || raw[i + 1] == '{'))
+			i = lex_skip_group(raw, i + 1);
+		else
+			i++;
+	}
+	pat = ft_substr(raw, 0, i);
+	pr[0] = NULL;
+	if (pat)
+		pr[0] = param_word(pm, pat, 1);
+	free(pat);
+	if (raw[i])
+		pr[1] = param_word(pm, raw + i + 1, 0);
+	else
+		pr[1] = ft_strdup("");
+	return (!pr[0] || !pr[1]);
+}
+
+/*/#pat/rep and /%pat/rep: the longest match must start (end) the
+ * value. It may be empty, then rep is just added at that end*/
+static int	replace_anchored(t_buf *out, const char *v, char **pr,
+		int suffix)
+{
+	ssize_t	len;
+	size_t	n;
+
+	n = ft_strlen(v);
+	len = param_affix_len(pr[0], v, 1, suffix);
+	if (len < 0)
+		return (buf_append(out, v, n));
+	if (suffix)
+		return (buf_append(out, v, n - len)
+			|| buf_append(out, pr[1], ft_strlen(pr[1])));
+	return (buf_append(out, pr[1], ft_strlen(pr[1]))
+		|| buf_append(out, v + len, n - len));
+}
+
+/*${NAME/pat/rep} replaces the first longest match, ${NAME//pat/rep}
+ * every one, ${NAME/#pat/rep} and ${NAME/%pat/rep} one at either end*/
+char	*param_replace(t_param *pm)
+{
+	t_buf	out;
+	char	*pr[2];
+	char	mode;
+	int		err;
+
+	mode = pm->op[1];
+	if (mode != '/' && mode != '#' && mode != '%')
+		mode = 0;
+	err = split_replace(pm, pm->op + 1 + (mode != 0), pr);
+	buf_init(&out);
+	if (!err && pm->value && (mode == '#' || mode == '%'))
+		err = replace_anchored(&out, pm->value, pr, mode == '%');
+	else if (!err && pm->value)
+		err = replace_into(&out, pm->value, pr, mode == '/');
+	free(pr[0]);
+	free(pr[1]);
+	if (err)
+		return (buf_free(&out), NULL);
+	return (buf_release(&out));
+}
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_slice.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:15:07 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:15:07 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Splits off:len at the first ':' and evaluates both halves as
+ * arithmetic. len stays 0 when absent. Returns 1 on error*/
+static int	substr_values(t_param *pm, char *spec, long long *off,
+		long long *len)
+{
+	char	*colon;
+	int		err;
+
+	colon = ft_strchr(spec, ':');
+	if (colon)
+		*colon = '\0';
+	err = arith_value(spec, pm->shell, off);
+	*len = 0;
+	if (colon && !err)
+		err = arith_value(colon + 1, pm->shell, len);
+	if (colon)
+		*colon = ':';
+	return (err);
+}
+
+/*${NAME:off} and ${NAME:off:len}. A negative offset counts from the
+ * end, a negative length is an end position counted from the end*/
+char	*param_substr(t_param *pm, char *spec)
+{
+	long long	off;
+	long long	len;
+	long long	n;
+
+	if (substr_values(pm, spec, &off, &len))
+		return (NULL);
+	n = 0;
+	if (pm->value)
+		n = ft_strlen(pm->value);
+	if (off < 0)
+		off += n;
+	if (off < 0 || off > n)
+		off = n;
+	if (!ft_strchr(spec, ':'))
+		len = n - off;
+	else if (len < 0)
+		len += n - off;
+	if (len < 0)
+		return (param_error(pm, "substring expression < 0"));
+	if (len > n - off)
+		len = n - off;
+	if (!pm->value)
+		return (ft_strdup(""));
+	return (ft_substr(pm->value, off, len));
+}
+
+/*Length of the shortest or longest prefix (suffix) of v that pat
+ * matches, -1 when there is none*/
+ssize_t	param_affix_len(const char *pat, const char *v, int longest,
+		int suffix)
+{
+	size_t	n;
+	size_t	t;
+	size_t	len;
+
+	n = ft_strlen(v);
+	t = 0;
+	while (t <= n)
+	{
+		len = t;
+		if (longest)
+			len = n - t;
+		if ((!suffix && glob_match(pat, v, len))
+			|| (suffix && glob_match(pat, v + n - len, len)))
+			return (len);
+		t++;
+	}
+	return (-1);
+}
+
+/*# and ## remove a matching prefix, % and %% a matching suffix*/
+char	*param_strip(t_param *pm)
+{
+	char	*pat;
+	ssize_t	len;
+	int		longest;
+	int		suffix;
+
+	suffix = (pm->op[0] == '%');
+	longest = (pm->op[1] == pm->op[0]);
+	pat = param_word(pm, pm->op + 1 + longest, 1);
+	if (!pat)
+		return (NULL);
+	if (!pm->value)
+		return (free(pat), ft_strdup(""));
+	len = param_affix_len(pat, pm->value, longest, suffix);
+	free(pat);
+	if (len < 0)
+		return (ft_strdup(pm->value));
+	if (suffix)
+		return (ft_substr(pm->value, 0, ft_strlen(pm->value) - len));
+	return (ft_strdup(pm->value + len));
+}
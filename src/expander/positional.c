@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   positional.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:47:08 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:47:08 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*$n, borrowed, NULL when unset*/
+char	*positional_get(t_shell *shell, int n)
+{
+	int	i;
+
+	if (n < 1 || !shell->params)
+		return (NULL);
+	i = 0;
+	while (shell->params[i] && i < n - 1)
+		i++;
+	return (shell->params[i]);
+}
+
+/*$* and $@ where they give a single string: the parameters joined by
+ * spaces*/
+char	*positional_join(t_shell *shell)
+{
+	t_buf	out;
+	int		i;
+
+	buf_init(&out);
+	i = 0;
+	while (shell->params && shell->params[i])
+	{
+		if ((i > 0 && buf_append(&out, " ", 1))
+			|| buf_append(&out, shell->params[i],
+				ft_strlen(shell->params[i])))
+			return (buf_free(&out), NULL);
+		i++;
+	}
+	return (buf_release(&out));
+}
+
+/*"$@" at raw[i] while fields are cut: every parameter is a field of
+ * its own, the first and last joined to the text around them. With
+ * none, a word that is only "$@" gives no field at all. Returns the
+ * index just past $@, -1 on error*/
+int	wexp_params(t_wexp *ex, int i)
+{
+	char	**params;
+	int		k;
+
+	params = ex->shell->params;
+	if ((!params || !params[0]) && ex->out.len == 0)
+		ex->quoted = 0;
+	k = 0;
+	while (params && params[k])
+	{
+		if (k > 0 && wexp_field_end(ex, ex->fields))
+			return (-1);
+		ex->quoted = 1;
+		if (wexp_quoted(ex, params[k], ft_strlen(params[k])))
+			return (-1);
+		k++;
+	}
+	return (i + 2);
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   procsub.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:01:14 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:42:23 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Child side: the pipe end becomes stdout for <(cmd), stdin for >(cmd),
+ * and the inner text runs like any other command line*/
+static void	procsub_child(char *inner, int *fds, int reading,
+		t_shell *shell)
+{
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+	if (reading)
+		dup2(fds[1], STDOUT_FILENO);
+	else
+		dup2(fds[0], STDIN_FILENO);
+	close(fds[0]);
+	close(fds[1]);
+	procsub_release(shell, 0);
+	free_tokens(shell->s_tokens);
+	shell->s_tokens = NULL;
+	free_tree(shell->s_tree);
+	shell->s_tree = NULL;
+	shell->s_cmds = NULL;
+	process_line(inner, shell, NULL);
+	free(inner);
+	cleanup_exit_child(shell, shell->exit_code);
+}
+
+/*Starts the producer/consumer and keeps our end of the pipe open, not
+ * close-on-exec, so the command can open it as /dev/fd/N*/
+static int	procsub_spawn(char *inner, int reading, t_shell *shell)
+{
+	t_procsub	*node;
+	int			fds[2];
+
+	node = malloc(sizeof(t_procsub));
+	if (!node || pipe2(fds, O_CLOEXEC) < 0)
+	{
+		free(node);
+		perror("minishell: process substitution");
+		return (-1);
+	}
+	node->pid = fork();
+	if (node->pid == 0)
+		procsub_child(inner, fds, reading, shell);
+	node->fd = fds[!reading];
+	close(fds[reading]);
+	if (node->pid < 0)
+	{
+		perror("minishell: fork");
+		close(node->fd);
+		return (free(node), -1);
+	}
+	fcntl(node->fd, F_SETFD, 0);
+	node->next = shell->procsubs;
+	shell->procsubs = node;
+	return (node->fd);
+}
+
+/*Replaces <(...) / >(...) at raw[i] with /dev/fd/N.
+ * Returns the index past the construct or -1 on error*/
+int	expand_procsub(char *raw, int i, t_wexp *ex)
+{
+	char	*inner;
+	char	*num;
+	int		end;
+	int		fd;
+
+	end = lex_skip_group(raw, i + 1);
+	inner = ft_substr(raw, i + 2, end - i - 2 - (raw[end - 1] == ')'));
+	if (!inner)
+		return (-1);
+	fd = procsub_spawn(inner, raw[i] == '<', ex->shell);
+	free(inner);
+	if (fd < 0)
+		return (-1);
+	num = ft_itoa(fd);
+	if (!num || buf_append(&ex->out, "/dev/fd/", 8)
+		|| buf_append(&ex->out, num, ft_strlen(num)))
+		end = -1;
+	free(num);
+	return (end);
+}
+
+/*Once the commands using them are forked the parent drops its ends,
+ * so producers see EPIPE and consumers see EOF*/
+void	procsub_close_fds(t_shell *shell)
+{
+	t_procsub	*node;
+
+	node = shell->procsubs;
+	while (node)
+	{
+		if (node->fd >= 0)
+			close(node->fd);
+		node->fd = -1;
+		node = node->next;
+	}
+}
+
+/*Reaps the substituted children (or, in a child, just forgets them)*/
+void	procsub_release(t_shell *shell, int wait_them)
+{
+	t_procsub	*next;
+
+	procsub_close_fds(shell);
+	while (shell->procsubs)
+	{
+		next = shell->procsubs->next;
+		if (wait_them && shell->procsubs->pid > 0)
+			while (waitpid(shell->procsubs->pid, NULL, 0) < 0
+				&& errno == EINTR)
+				;
+		free(shell->procsubs);
+		shell->procsubs = next;
+	}
+}
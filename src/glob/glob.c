@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:23:47 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:23:47 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Pathname expansion of one field, pat being the field in pattern form.
+ * Matches replace it, sorted; with no match, or no active glob
+ * character at all, the field stands for itself. Takes pat*/
+int	glob_field(char *pat, t_argv *av, t_shell *shell)
+{
+	t_glob	g;
+	char	*word;
+	size_t	len;
+	int		err;
+
+	len = ft_strlen(pat);
+	if (glob_has_meta(pat, len))
+	{
+		buf_init(&g.path);
+		g.av = av;
+		g.found = 0;
+		g.shell = shell;
+		err = (pat[0] == '/' && buf_append(&g.path, "/", 1));
+		err = (err || glob_walk(&g, pat + (pat[0] == '/')));
+		buf_free(&g.path);
+		if (err || g.found)
+			return (free(pat), err);
+	}
+	word = glob_unescape(pat, len);
+	free(pat);
+	return (argv_push(av, word));
+}
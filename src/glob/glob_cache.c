@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_cache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:23:47 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:23:47 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Drops one reference, the last one frees the listing*/
+void	dirlist_release(t_dirlist *dl)
+{
+	if (!dl || --dl->refs > 0)
+		return ;
+	free(dl->names);
+	free(dl->ents);
+	free(dl);
+}
+
+void	glob_cache_clear(t_shell *shell)
+{
+	int	i;
+
+	i = 0;
+	while (i < GLOB_CACHE_SIZE)
+	{
+		dirlist_release(shell->glob_cache[i]);
+		shell->glob_cache[i++] = NULL;
+	}
+}
+
+/*Whether dl still lists the directory st describes. Any entry added,
+ * removed or renamed moves the directory mtime*/
+static int	dirlist_fresh(t_dirlist *dl, struct stat *st)
+{
+	return (dl && dl->ino == st->st_ino && dl->dev == st->st_dev
+		&& dl->mtime.tv_sec == st->st_mtim.tv_sec
+		&& dl->mtime.tv_nsec == st->st_mtim.tv_nsec);
+}
+
+/*Stamps dl with the identity of its directory and keeps it in slot.
+ * A change made within the clock tick of the scan leaves the mtime as
+ * it was, so a directory touched in the last second or so is listed but
+ * not kept*/
+static void	dirlist_keep(t_dirlist **slot, t_dirlist *dl, struct stat *st)
+{
+	struct timespec	now;
+
+	dl->dev = st->st_dev;
+	dl->ino = st->st_ino;
+	dl->mtime = st->st_mtim;
+	if (clock_gettime(CLOCK_REALTIME, &now) < 0
+		|| st->st_mtim.tv_sec >= now.tv_sec - 1)
+		return ;
+	dirlist_release(*slot);
+	*slot = dl;
+	dl->refs++;
+}
+
+/*Listing of the directory at path, from the cache while its inode and
+ * mtime match. Release it when done. NULL when it can't be read*/
+t_dirlist	*glob_dir(const char *path, t_shell *shell)
+{
+	t_dirlist	**slot;
+	t_dirlist	*dl;
+	struct stat	st;
+	int			fd;
+
+	fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (fd < 0)
+		return (NULL);
+	if (fstat(fd, &st) < 0)
+		return (close(fd), NULL);
+	slot = &shell->glob_cache[st.st_ino % GLOB_CACHE_SIZE];
+	if (dirlist_fresh(*slot, &st))
+	{
+		close(fd);
+		(*slot)->refs++;
+		return (*slot);
+	}
+	dl = dirlist_read(fd);
+	if (dl)
+		dirlist_keep(slot, dl, &st);
+	return (dl);
+}
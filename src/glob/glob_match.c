@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_match.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:13:11 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:15:36 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*One member of a [...] set at pat[*i]: a char or a range a-z*/
+static int	set_member(const char *pat, size_t *i, unsigned char c)
+{
+	int	found;
+
+	if (pat[*i] == '\\' && pat[*i + 1])
+		(*i)++;
+	if (pat[*i + 1] == '-' && pat[*i + 2] && pat[*i + 2] != ']')
+	{
+		found = (c >= (unsigned char)pat[*i]
+				&& c <= (unsigned char)pat[*i + 2]);
+		*i += 3;
+		return (found);
+	}
+	return (c == (unsigned char)pat[(*i)++]);
+}
+
+/*[...] set at pat[*p], '!' or '^' negates it, a leading ']' is a
+ * member. Moves *p past the set. Returns -1 if the set is unclosed, so
+ * the '[' is taken literally*/
+static int	match_bracket(const char *pat, size_t *p, char c)
+{
+	size_t	start;
+	size_t	i;
+	int		negate;
+	int		found;
+
+	negate = (pat[*p + 1] == '!' || pat[*p + 1] == '^');
+	start = *p + 1 + negate;
+	i = start;
+	found = 0;
+	while (pat[i] && (pat[i] != ']' || i == start))
+		found |= set_member(pat, &i, c);
+	if (!pat[i])
+		return (-1);
+	*p = i + 1;
+	return (found != negate);
+}
+/*Matches one pattern element other than '*' against c and moves *p
+ * past it on success*/
+int	glob_match_one(const char *pat, size_t *p, char c)
+{
+	int	ret;
+
+	if (pat[*p] == '[')
+	{
+		ret = match_bracket(pat, p, c);
+		if (ret >= 0)
+			return (ret);
+	}
+	if (pat[*p] == '\\' && pat[*p + 1])
+		(*p)++;
+	if (pat[*p] != '?' && pat[*p] != c)
+		return (0);
+	(*p)++;
+	return (1);
+}
+
+/*After a mismatch the last '*' absorbs one more byte and matching
+ * resumes right after it. Returns 0 when there is no '*' to retry*/
+static int	star_retry(size_t *p, size_t *s, size_t *star)
+{
+	if (!star[0])
+		return (0);
+	*p = star[0];
+	*s = ++star[1];
+	return (1);
+}
+
+/*Shell pattern match of the first len bytes of str: * ? [...] and \
+ * escapes. Iterative: only the last '*' is ever retried, so the cost is
+ * bounded by len * strlen(pat) with no recursion. Returns 1 on a match*/
+int	glob_match(const char *pat, const char *str, size_t len)
+{
+	size_t	p;
+	size_t	s;
+	size_t	star[2];
+
+	p = 0;
+	s = 0;
+	star[0] = 0;
+	while (s < len || pat[p] == '*')
+	{
+		if (pat[p] == '*')
+		{
+			star[0] = ++p;
+			star[1] = s;
+		}
+		else if (glob_match_one(pat, &p, str[s]))
+			s++;
+		else if (!star_retry(&p, &s, star))
+			return (0);
+	}
+	return (pat[p] == '\0');
+}
@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_prefix.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:14:45 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 13:14:45 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*A '*' may match nothing, so the element after it is live as well*/
+static void	prefix_close(const char *pat, unsigned char *live)
+{
+	size_t	p;
+
+	p = 0;
+	while (pat[p])
+	{
+		if (live[p] && pat[p] == '*')
+			live[p + 1] = 1;
+		p++;
+	}
+}
+
+/*Moves every live place in pat past c into next, a '*' stays where it
+ * is. Returns 0 when no place survives*/
+static int	prefix_step(const char *pat, unsigned char *live,
+		unsigned char *next, char c)
+{
+	size_t	p;
+	size_t	q;
+	int		any;
+
+	any = 0;
+	p = 0;
+	while (pat[p])
+	{
+		q = p;
+		if (live[p] && (pat[p] == '*' || glob_match_one(pat, &q, c)))
+		{
+			next[q] = 1;
+			any = 1;
+		}
+		p++;
+	}
+	return (any);
+}
+
+/*Length of the longest prefix of the n bytes of v matched by pat, -1
+ * when there is none. One pass over v that follows every place in pat
+ * at once, so a '*' never makes it go back*/
+ssize_t	glob_prefix(const char *pat, const char *v, size_t n)
+{
+	unsigned char	*live;
+	ssize_t			best;
+	size_t			m;
+	size_t			k;
+
+	m = ft_strlen(pat);
+	live = ft_calloc(2, m + 1);
+	if (!live)
+		return (-1);
+	live[0] = 1;
+	best = -1;
+	k = 0;
+	while (1)
+	{
+		prefix_close(pat, live);
+		if (live[m])
+			best = k;
+		ft_bzero(live + m + 1, m + 1);
+		if (k == n || !prefix_step(pat, live, live + m + 1, v[k++]))
+			break ;
+		ft_memcpy(live, live + m + 1, m + 1);
+	}
+	free(live);
+	return (best);
+}
+
+/*Whether pat matches anywhere in the n bytes of v, in one pass*/
+int	glob_found(const char *pat, const char *v, size_t n)
+{
+	char	*any;
+	ssize_t	len;
+
+	any = ft_strjoin("*", pat);
+	if (!any)
+		return (1);
+	len = glob_prefix(any, v, n);
+	free(any);
+	return (len >= 0);
+}
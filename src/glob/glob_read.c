@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_read.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:23:47 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:23:47 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static int	dent_cmp(const void *a, const void *b)
+{
+	return (ft_strcmp(((const t_dent *)a)->name, ((const t_dent *)b)->name));
+}
+
+/*Every entry but . and .., names packed '\0' separated in one block and
+ * their d_type alongside. Returns 1 on error*/
+static int	read_names(DIR *dir, t_buf *names, t_buf *types)
+{
+	struct dirent	*de;
+
+	errno = 0;
+	de = readdir(dir);
+	while (de)
+	{
+		if (ft_strcmp(de->d_name, ".") && ft_strcmp(de->d_name, "..")
+			&& (buf_append(names, de->d_name, ft_strlen(de->d_name) + 1)
+				|| buf_append(types, (char *)&de->d_type, 1)))
+			return (1);
+		de = readdir(dir);
+	}
+	return (errno != 0);
+}
+
+/*Points the entries of dl into the packed names, then sorts them*/
+static int	index_names(t_dirlist *dl, t_buf *names, t_buf *types)
+{
+	size_t	off;
+	size_t	i;
+
+	dl->count = types->len;
+	dl->ents = malloc(sizeof(t_dent) * (dl->count + 1));
+	dl->names = buf_release(names);
+	if (!dl->ents || !dl->names)
+		return (1);
+	off = 0;
+	i = 0;
+	while (i < dl->count)
+	{
+		dl->ents[i].name = dl->names + off;
+		dl->ents[i].type = types->data[i];
+		off += ft_strlen(dl->names + off) + 1;
+		i++;
+	}
+	qsort(dl->ents, dl->count, sizeof(t_dent), dent_cmp);
+	return (0);
+}
+
+/*Lists the directory open on fd, which is taken over. The listing
+ * comes with one reference. NULL on error*/
+t_dirlist	*dirlist_read(int fd)
+{
+	t_dirlist	*dl;
+	DIR			*dir;
+	t_buf		names;
+	t_buf		types;
+	int			err;
+
+	dir = fdopendir(fd);
+	if (!dir)
+		return (close(fd), NULL);
+	dl = ft_calloc(1, sizeof(t_dirlist));
+	if (!dl)
+		return (closedir(dir), NULL);
+	dl->refs = 1;
+	buf_init(&names);
+	buf_init(&types);
+	err = (read_names(dir, &names, &types)
+			|| index_names(dl, &names, &types));
+	closedir(dir);
+	buf_free(&names);
+	buf_free(&types);
+	if (err)
+		return (dirlist_release(dl), NULL);
+	return (dl);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_star.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:27:13 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:27:13 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Pushes the walk root followed by the first len bytes of rel*/
+static int	star_push(t_glob *g, char *rel, size_t len)
+{
+	size_t	base;
+	int		err;
+
+	base = g->path.len;
+	err = (buf_append(&g->path, rel, len)
+			|| argv_push(g->av, ft_strdup(g->path.data)));
+	g->found += !err;
+	g->path.len = base;
+	if (g->path.data)
+		g->path.data[base] = '\0';
+	return (err);
+}
+
+/*A final **: everything below the root, directories included*/
+static int	star_all(t_glob *g, t_argv *ents)
+{
+	size_t	len;
+	int		i;
+
+	i = 0;
+	while (i < ents->len)
+	{
+		len = ft_strlen(ents->v[i]);
+		len -= (ents->v[i][len - 1] == '/');
+		if (star_push(g, ents->v[i++], len))
+			return (1);
+	}
+	return (0);
+}
+
+/*A last component after **: it is matched against the names the walk
+ * already has, so no directory is listed twice*/
+static int	star_match(t_glob *g, t_argv *ents, char *comp)
+{
+	char	*name;
+	size_t	len;
+	int		i;
+
+	i = 0;
+	while (i < ents->len)
+	{
+		len = ft_strlen(ents->v[i]);
+		len -= (ents->v[i][len - 1] == '/');
+		name = ents->v[i] + len;
+		while (name > ents->v[i] && name[-1] != '/')
+			name--;
+		if (glob_match(comp, name, len - (name - ents->v[i]))
+			&& star_push(g, ents->v[i], len))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/*Any other rest is walked from the root and from every directory below
+ * it, ** standing for zero or more of them*/
+static int	star_dirs(t_glob *g, t_argv *ents, char *rest)
+{
+	size_t	base;
+	size_t	len;
+	int		err;
+	int		i;
+
+	base = g->path.len;
+	err = glob_walk(g, rest);
+	i = 0;
+	while (!err && i < ents->len)
+	{
+		len = ft_strlen(ents->v[i]);
+		if (ents->v[i][len - 1] == '/')
+			err = (buf_append(&g->path, ents->v[i], len)
+					|| glob_walk(g, rest));
+		g->path.len = base;
+		i++;
+	}
+	if (g->path.data)
+		g->path.data[base] = '\0';
+	return (err);
+}
+
+/*A ** component, rest being what follows it. The tree below g->path
+ * is walked once, in parallel; hidden names and symlinked directories
+ * are not descended into*/
+int	glob_star(t_glob *g, char *rest)
+{
+	t_argv	ents;
+	int		err;
+
+	ft_bzero(&ents, sizeof(t_argv));
+	if (g->path.len)
+		err = rwalk_run(g->path.data, &ents, g->shell);
+	else
+		err = rwalk_run(".", &ents, g->shell);
+	if (!err && !*rest)
+		err = star_all(g, &ents);
+	else if (!err && rest[1] && rest[1] != '.' && !ft_strchr(rest + 1, '/'))
+		err = star_match(g, &ents, rest + 1);
+	else if (!err)
+		err = star_dirs(g, &ents, rest + 1);
+	free_tab(ents.v);
+	return (err);
+}
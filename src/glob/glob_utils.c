@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_utils.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:15:07 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:25:24 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Index past the pattern element at pat[i]*/
+static size_t	elem_end(const char *pat, size_t i)
+{
+	size_t	j;
+
+	if (pat[i] == '\\' && pat[i + 1])
+		return (i + 2);
+	if (pat[i] != '[')
+		return (i + 1);
+	j = i + 1;
+	j += (pat[j] == '!' || pat[j] == '^');
+	if (pat[j] == ']')
+		j++;
+	while (pat[j] && pat[j] != ']')
+	{
+		if (pat[j] == '\\' && pat[j + 1])
+			j++;
+		j++;
+	}
+	if (!pat[j])
+		return (i + 1);
+	return (j + 1);
+}
+
+/*Number of bytes every match of pat has, -1 if it holds a '*'*/
+ssize_t	glob_fixed_len(const char *pat)
+{
+	size_t	i;
+	ssize_t	n;
+
+	i = 0;
+	n = 0;
+	while (pat[i])
+	{
+		if (pat[i] == '*')
+			return (-1);
+		i = elem_end(pat, i);
+		n++;
+	}
+	return (n);
+}
+
+/*Whether the first len bytes of pat hold an active * ? or [...] set*/
+int	glob_has_meta(const char *pat, size_t len)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < len && pat[i])
+	{
+		if (pat[i] == '*' || pat[i] == '?'
+			|| (pat[i] == '[' && elem_end(pat, i) > i + 1))
+			return (1);
+		i = elem_end(pat, i);
+	}
+	return (0);
+}
+
+/*Copy of the first len bytes of pat with the '\' escapes removed*/
+char	*glob_unescape(const char *pat, size_t len)
+{
+	char	*out;
+	size_t	i;
+	size_t	j;
+
+	out = malloc(len + 1);
+	if (!out)
+		return (NULL);
+	i = 0;
+	j = 0;
+	while (i < len && pat[i])
+	{
+		if (pat[i] == '\\' && i + 1 < len)
+			i++;
+		out[j++] = pat[i++];
+	}
+	out[j] = '\0';
+	return (out);
+}
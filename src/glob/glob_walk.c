@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_walk.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:23:47 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:28:42 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*The path walked so far is a match*/
+static int	glob_push(t_glob *g)
+{
+	if (argv_push(g->av, ft_strdup(g->path.data)))
+		return (1);
+	g->found++;
+	return (0);
+}
+
+/*A component without glob characters needs no listing: it is added as
+ * is, and the path only has to exist once the pattern is done*/
+static int	glob_literal(t_glob *g, char *pat, size_t len)
+{
+	struct stat	st;
+	char		*name;
+	int			err;
+
+	name = glob_unescape(pat, len);
+	if (!name || buf_append(&g->path, name, ft_strlen(name)))
+		return (free(name), 1);
+	free(name);
+	err = 0;
+	if (pat[len] == '/')
+		err = (buf_append(&g->path, "/", 1) || glob_walk(g, pat + len + 1));
+	else if (lstat(g->path.data, &st) == 0)
+		err = glob_push(g);
+	return (err);
+}
+
+/*Follows a matching entry: a result when the pattern ends here, else a
+ * directory to walk with the rest. d_type spares a stat() mostly*/
+static int	glob_enter(t_glob *g, t_dent *ent, char *rest)
+{
+	struct stat	st;
+
+	if (buf_append(&g->path, ent->name, ft_strlen(ent->name)))
+		return (1);
+	if (!*rest)
+		return (glob_push(g));
+	if (ent->type != DT_DIR && ent->type != DT_LNK
+		&& ent->type != DT_UNKNOWN)
+		return (0);
+	if (ent->type != DT_DIR
+		&& (stat(g->path.data, &st) < 0 || !S_ISDIR(st.st_mode)))
+		return (0);
+	if (buf_append(&g->path, "/", 1))
+		return (1);
+	return (glob_walk(g, rest + 1));
+}
+
+/*Matches comp against every entry of the directory in g->path. Names
+ * starting with '.' need the pattern to start with one too*/
+static int	glob_scan(t_glob *g, char *comp, char *rest)
+{
+	t_dirlist	*dl;
+	t_dent		*ent;
+	size_t		base;
+	size_t		i;
+	int			err;
+
+	if (g->path.len)
+		dl = glob_dir(g->path.data, g->shell);
+	else
+		dl = glob_dir(".", g->shell);
+	if (!dl)
+		return (0);
+	base = g->path.len;
+	err = 0;
+	i = 0;
+	while (!err && i < dl->count)
+	{
+		ent = &dl->ents[i++];
+		if ((ent->name[0] != '.' || comp[0] == '.')
+			&& glob_match(comp, ent->name, ft_strlen(ent->name)))
+			err = glob_enter(g, ent, rest);
+		g->path.len = base;
+	}
+	dirlist_release(dl);
+	return (err);
+}
+
+/*Walks the first '/' separated component of pat from the directory in
+ * g->path, then the rest from each match. Entries come sorted, so the
+ * matches do too. A whole ** component spans any depth*/
+int	glob_walk(t_glob *g, char *pat)
+{
+	char	*comp;
+	size_t	len;
+	size_t	base;
+	int		err;
+
+	len = 0;
+	while (pat[len] && pat[len] != '/')
+		len++;
+	base = g->path.len;
+	if (len == 2 && pat[0] == '*' && pat[1] == '*')
+		err = glob_star(g, pat + len);
+	else if (!glob_has_meta(pat, len))
+		err = glob_literal(g, pat, len);
+	else
+	{
+		comp = ft_substr(pat, 0, len);
+		err = (!comp || glob_scan(g, comp, pat + len));
+		free(comp);
+	}
+	g->path.len = base;
+	if (g->path.data)
+		g->path.data[base] = '\0';
+	return (err);
+}
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rwalk.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:27:14 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:53:50 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Walker threads for a run: MINISHELL_GLOB_THREADS, else one per online
+ * CPU, at most GLOB_MAX_THREADS. MINISHELL_GLOB_THREADS=1 walks in the
+ * shell's own thread*/
+static int	rwalk_threads(t_shell *shell)
+{
+	char	*value;
+	long	n;
+
+	value = get_env_value(shell->env_vars, "MINISHELL_GLOB_THREADS");
+	if (value && *value)
+		n = ft_atoi(value);
+	else
+		n = sysconf(_SC_NPROCESSORS_ONLN);
+	if (n < 1)
+		n = 1;
+	if (n > GLOB_MAX_THREADS)
+		n = GLOB_MAX_THREADS;
+	return (n);
+}
+
+static int	path_cmp(const void *a, const void *b)
+{
+	return (ft_strcmp(*(char *const *)a, *(char *const *)b));
+}
+
+static int	rwalk_init(t_rwalk *walk, const char *root, t_shell *shell)
+{
+	int	i;
+
+	walk->root_fd = open(root, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (walk->root_fd < 0)
+		return (1);
+	walk->count = rwalk_threads(shell);
+	walk->pending = 0;
+	walk->queued = 0;
+	walk->err = 0;
+	walk->workers = ft_calloc(walk->count, sizeof(t_rworker));
+	if (!walk->workers)
+		return (close(walk->root_fd), 1);
+	i = 0;
+	while (i < walk->count)
+	{
+		pthread_mutex_init(&walk->workers[i].lock, NULL);
+		walk->workers[i].walk = walk;
+		walk->workers[i].id = i;
+		i++;
+	}
+	pthread_mutex_init(&walk->idle_lock, NULL);
+	pthread_cond_init(&walk->idle, NULL);
+	return (0);
+}
+
+/*Hands what every worker found over to out, sorted, and frees them*/
+static int	rwalk_collect(t_rwalk *walk, t_argv *out)
+{
+	t_rworker	*w;
+	int			err;
+	int			i;
+	int			j;
+
+	err = walk->err;
+	i = 0;
+	while (i < walk->count)
+	{
+		w = &walk->workers[i++];
+		j = 0;
+		while (j < w->found.len)
+			err |= argv_push(out, w->found.v[j++]);
+		free(w->found.v);
+		free(w->tasks);
+		pthread_mutex_destroy(&w->lock);
+	}
+	free(walk->workers);
+	close(walk->root_fd);
+	if (!err && out->len > 1)
+		qsort(out->v, out->len, sizeof(char *), path_cmp);
+	return (err);
+}
+
+/*Every path below root, by a pool of work-stealing threads: each lists
+ * the directories of its own deque and steals from the others once it
+ * runs dry. Directories come '/' terminated. An unreadable root gives
+ * nothing. Returns 1 on error*/
+int	rwalk_run(const char *root, t_argv *out, t_shell *shell)
+{
+	t_rwalk	walk;
+	int		i;
+
+	if (rwalk_init(&walk, root, shell))
+		return (0);
+	if (rq_push(&walk.workers[0], NULL, ft_strdup("."), ft_strdup("")))
+		walk.err = 1;
+	i = 1;
+	while (i < walk.count && pthread_create(&walk.workers[i].thread, NULL,
+			rwalk_worker, &walk.workers[i]) == 0)
+		i++;
+	rwalk_worker(&walk.workers[0]);
+	while (--i > 0)
+		pthread_join(walk.workers[i].thread, NULL);
+	pthread_mutex_destroy(&walk.idle_lock);
+	pthread_cond_destroy(&walk.idle);
+	return (rwalk_collect(&walk, out));
+}
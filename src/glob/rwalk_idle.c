@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rwalk_idle.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:16:11 by abroslav          #+#    #+#             */
+/*   Updated: 2026/10/19 13:16:11 by abroslav         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Blocks a worker that found nothing to take until a task is queued or
+ * the walk is over. Both are checked under idle_lock, which every wake
+ * takes, so a wake can't slip in between the check and the wait*/
+void	rwalk_idle(t_rwalk *walk)
+{
+	pthread_mutex_lock(&walk->idle_lock);
+	while (__atomic_load_n(&walk->pending, __ATOMIC_SEQ_CST) > 0
+		&& __atomic_load_n(&walk->queued, __ATOMIC_SEQ_CST) == 0)
+		pthread_cond_wait(&walk->idle, &walk->idle_lock);
+	pthread_mutex_unlock(&walk->idle_lock);
+}
+
+/*One idle worker for a new task, all of them once the walk is over*/
+void	rwalk_wake(t_rwalk *walk, int all)
+{
+	pthread_mutex_lock(&walk->idle_lock);
+	if (all)
+		pthread_cond_broadcast(&walk->idle);
+	else
+		pthread_cond_signal(&walk->idle);
+	pthread_mutex_unlock(&walk->idle_lock);
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rwalk_queue.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:27:14 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:18:47 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Makes room for one more task, moving the live ones back to the start
+ * first. Called with the lock held*/
+static int	rq_room(t_rworker *w)
+{
+	t_rtask	*grown;
+	size_t	cap;
+
+	if (w->head > 0)
+	{
+		ft_memmove(w->tasks, w->tasks + w->head,
+			sizeof(t_rtask) * (w->len - w->head));
+		w->len -= w->head;
+		w->head = 0;
+	}
+	if (w->len < w->cap)
+		return (0);
+	cap = w->cap * 2 + 16;
+	grown = malloc(sizeof(t_rtask) * cap);
+	if (!grown)
+		return (1);
+	if (w->tasks)
+		ft_memcpy(grown, w->tasks, sizeof(t_rtask) * w->len);
+	free(w->tasks);
+	w->tasks = grown;
+	w->cap = cap;
+	return (0);
+}
+
+/*Queues a directory on w, taking name and path. It counts as pending
+ * for the walk, and holds its parent open, until it is visited*/
+int	rq_push(t_rworker *w, t_rdir *parent, char *name, char *path)
+{
+	int	err;
+
+	pthread_mutex_lock(&w->lock);
+	err = (!name || !path || (w->len == w->cap && rq_room(w)));
+	if (!err)
+	{
+		w->tasks[w->len].parent = parent;
+		w->tasks[w->len].name = name;
+		w->tasks[w->len++].path = path;
+		if (parent)
+			__atomic_add_fetch(&parent->refs, 1, __ATOMIC_ACQ_REL);
+		__atomic_add_fetch(&w->walk->pending, 1, __ATOMIC_ACQ_REL);
+		__atomic_add_fetch(&w->walk->queued, 1, __ATOMIC_SEQ_CST);
+	}
+	pthread_mutex_unlock(&w->lock);
+	if (!err)
+		return (rwalk_wake(w->walk, 0), 0);
+	free(name);
+	free(path);
+	return (err);
+}
+
+/*The owner takes its newest task: depth first, with the parent dir
+ * still hot and few directories held open*/
+int	rq_pop(t_rworker *w, t_rtask *t)
+{
+	int	found;
+
+	pthread_mutex_lock(&w->lock);
+	found = (w->len > w->head);
+	if (found)
+		*t = w->tasks[--w->len];
+	if (found)
+		__atomic_sub_fetch(&w->walk->queued, 1, __ATOMIC_SEQ_CST);
+	pthread_mutex_unlock(&w->lock);
+	return (found);
+}
+
+/*A thief takes the oldest task, the one closest to the root and so the
+ * likeliest to hold a large subtree*/
+int	rq_steal(t_rworker *w, t_rtask *t)
+{
+	int	found;
+
+	pthread_mutex_lock(&w->lock);
+	found = (w->len > w->head);
+	if (found)
+		*t = w->tasks[w->head++];
+	if (found)
+		__atomic_sub_fetch(&w->walk->queued, 1, __ATOMIC_SEQ_CST);
+	pthread_mutex_unlock(&w->lock);
+	return (found);
+}
+
+/*Drops a reference to an open directory, the last one closes it*/
+void	rdir_release(t_rdir *d)
+{
+	if (!d || __atomic_sub_fetch(&d->refs, 1, __ATOMIC_ACQ_REL) > 0)
+		return ;
+	closedir(d->dir);
+	free(d);
+}
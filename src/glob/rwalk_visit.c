@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rwalk_visit.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:27:14 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:18:47 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Opens the task's directory relative to its parent's fd, or to the
+ * walk root when descriptors run out. The parent is let go either way*/
+static t_rdir	*rwalk_open(t_rwalk *walk, t_rtask *t)
+{
+	t_rdir	*node;
+	int		fd;
+
+	if (!t->parent)
+		fd = openat(walk->root_fd, ".", RWALK_OPEN_FLAGS);
+	else
+		fd = openat(dirfd(t->parent->dir), t->name, RWALK_OPEN_FLAGS);
+	if (fd < 0 && (errno == EMFILE || errno == ENFILE))
+		fd = openat(walk->root_fd, t->path, RWALK_OPEN_FLAGS);
+	rdir_release(t->parent);
+	if (fd < 0)
+		return (NULL);
+	node = malloc(sizeof(t_rdir));
+	if (node)
+		node->dir = fdopendir(fd);
+	if (!node || !node->dir)
+		return (free(node), close(fd), NULL);
+	node->refs = 1;
+	return (node);
+}
+
+/*Records one entry of node and queues it when it is a directory.
+ * Symlinks are not followed, so the walk can't loop*/
+static int	rwalk_entry(t_rworker *w, t_rdir *node, char *dir_path,
+	struct dirent *de)
+{
+	struct stat	st;
+	char		*path;
+	size_t		plen;
+	size_t		nlen;
+	int			is_dir;
+
+	is_dir = (de->d_type == DT_DIR);
+	if (de->d_type == DT_UNKNOWN && fstatat(dirfd(node->dir), de->d_name,
+			&st, AT_SYMLINK_NOFOLLOW) == 0)
+		is_dir = S_ISDIR(st.st_mode);
+	plen = ft_strlen(dir_path);
+	nlen = ft_strlen(de->d_name);
+	path = malloc(plen + nlen + 2);
+	if (!path)
+		return (1);
+	ft_memcpy(path, dir_path, plen);
+	ft_memcpy(path + plen, de->d_name, nlen);
+	path[plen + nlen] = '/';
+	path[plen + nlen + is_dir] = '\0';
+	if (argv_push(&w->found, path))
+		return (1);
+	if (!is_dir)
+		return (0);
+	return (rq_push(w, node, ft_strdup(de->d_name), ft_strdup(path)));
+}
+
+/*Lists one directory. Hidden entries are skipped, as ** skips them.
+ * The task is only done once its subdirectories are queued*/
+static void	rwalk_visit(t_rworker *w, t_rtask *t)
+{
+	struct dirent	*de;
+	t_rdir			*node;
+
+	node = rwalk_open(w->walk, t);
+	if (node)
+	{
+		de = readdir(node->dir);
+		while (de && !__atomic_load_n(&w->walk->err, __ATOMIC_RELAXED))
+		{
+			if (de->d_name[0] != '.' && rwalk_entry(w, node, t->path, de))
+				__atomic_store_n(&w->walk->err, 1, __ATOMIC_RELAXED);
+			de = readdir(node->dir);
+		}
+		rdir_release(node);
+	}
+	free(t->name);
+	free(t->path);
+	if (__atomic_sub_fetch(&w->walk->pending, 1, __ATOMIC_SEQ_CST) == 0)
+		rwalk_wake(w->walk, 1);
+}
+
+/*Own work first, then a steal from each other worker in turn*/
+static int	rwalk_take(t_rworker *w, t_rtask *t)
+{
+	int	i;
+
+	if (rq_pop(w, t))
+		return (1);
+	i = 1;
+	while (i < w->walk->count)
+	{
+		if (rq_steal(&w->walk->workers[(w->id + i) % w->walk->count], t))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/*Thread body. Runs until no task is queued or being visited anywhere,
+ * as only a visit can queue more. With nothing to take it sleeps*/
+void	*rwalk_worker(void *arg)
+{
+	t_rworker	*w;
+	t_rtask		t;
+
+	w = arg;
+	while (__atomic_load_n(&w->walk->pending, __ATOMIC_ACQUIRE) > 0)
+	{
+		if (rwalk_take(w, &t))
+			rwalk_visit(w, &t);
+		else
+			rwalk_idle(w->walk);
+	}
+	return (NULL);
+}
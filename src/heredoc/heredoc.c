@@ -6,28 +6,31 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/12 22:59:11 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/01/20 23:29:31 by fshiniti         ###   ########.fr       */
+/*   Updated: 2026/10/19 13:26:05 by fshiniti         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
-static void	write_hd_line(t_hd_ctx *ctx, char *line)
+static int	write_hd_line(t_hd_ctx *ctx, char *line)
 {
 	char	*expanded;
+	int		ret;
 
 	if (ctx->expand)
 	{
-		expanded = expand_vars(line, ctx->env, ctx->exit_code);
-		write(ctx->fd, expanded, ft_strlen(expanded));
+		expanded = expand_vars(line, ctx->shell);
+		if (!expanded)
+			return (1);
+		ret = heredoc_write(ctx, expanded, ft_strlen(expanded));
 		free(expanded);
 	}
 	else
-		write(ctx->fd, line, ft_strlen(line));
-	write(ctx->fd, "\n", 1);
+		ret = heredoc_write(ctx, line, ft_strlen(line));
+	return (ret || heredoc_write(ctx, "\n", 1));
 }
 
-static int	read_heredoc_lines(t_hd_ctx *ctx, char *delimiter)
+static int	read_body_lines(t_buf *raw, char *delimiter)
 {
 	char	*line;
 
@@ -37,89 +40,84 @@ static int	read_heredoc_lines(t_hd_ctx *ctx, char *delimiter)
 		if (isatty(STDIN_FILENO))
 			line = readline("> ");
 		else
-			line = heredoc_read_line();
+			line = read_line();
 		if (!line)
 		{
 			if (g_last_signal == SIGINT)
 				return (1);
-			heredoc_eof_warning(delimiter);
-			break ;
+			return (heredoc_eof_warning(delimiter), 0);
 		}
 		if (ft_strcmp(line, delimiter) == 0)
 			return (free(line), 0);
-		write_hd_line(ctx, line);
+		if (buf_append(raw, line, ft_strlen(line))
+			|| buf_append(raw, "\n", 1))
+			return (free(line), 1);
 		free(line);
 	}
-	return (0);
 }
 
-static int	heredoc_read(t_hd_ctx *ctx, char *delim)
+/*The body as typed, each line ending in '\n', or NULL on ^C. It is
+ * read once, when its line is parsed, and expanded on every run*/
+char	*heredoc_body(char *delimiter)
 {
-	int	stdin_bak;
-	int	ret;
+	t_buf	raw;
+	char	*clean;
+	int		stdin_bak;
+	int		ret;
 
+	clean = heredoc_remove_quotes(delimiter);
+	if (!clean)
+		return (NULL);
+	buf_init(&raw);
 	stdin_bak = dup(STDIN_FILENO);
 	setup_signals_heredoc();
-	ret = read_heredoc_lines(ctx, delim);
+	ret = read_body_lines(&raw, clean);
 	if (ret)
-	{
 		dup2(stdin_bak, STDIN_FILENO);
-		close(stdin_bak);
-		setup_signals();
-		return (1);
-	}
 	close(stdin_bak);
 	setup_signals();
-	return (0);
+	free(clean);
+	if (ret)
+		return (buf_free(&raw), NULL);
+	return (buf_release(&raw));
 }
 
-int	handle_heredoc(char *delimiter, char **env, int last_exit)
+int	heredoc_replay(char *delimiter, char *body, t_shell *shell)
 {
 	t_hd_ctx	ctx;
-	char		*clean_delim;
-	char		*tmp;
-	int			fd;
+	char		*line;
+	size_t		n;
 
 	ctx.expand = !heredoc_has_quotes(delimiter);
-	ctx.env = env;
-	ctx.exit_code = last_exit;
-	clean_delim = heredoc_remove_quotes(delimiter);
-	tmp = heredoc_gen_temp_filename();
-	ctx.fd = open(tmp, O_CREAT | O_WRONLY | O_TRUNC, 0600);
-	if (ctx.fd < 0)
-		return (perror("minishell: heredoc"),
-			free(clean_delim), free(tmp), -1);
-	if (heredoc_read(&ctx, clean_delim))
+	ctx.shell = shell;
+	ctx.fd = -1;
+	buf_init(&ctx.body);
+	while (*body)
 	{
-		close(ctx.fd);
-		unlink(tmp);
-		return (free(clean_delim), free(tmp), -1);
+		n = ft_strchr(body, '\n') - body;
+		line = ft_substr(body, 0, n);
+		if (!line || write_hd_line(&ctx, line))
+		{
+			free(line);
+			if (ctx.fd >= 0)
+				close(ctx.fd);
+			return (buf_free(&ctx.body), -1);
+		}
+		free(line);
+		body += n + 1;
 	}
-	close(ctx.fd);
-	fd = open(tmp, O_RDONLY);
-	return (unlink(tmp), free(tmp), free(clean_delim), fd);
+	return (heredoc_deliver(&ctx));
 }
 
-void	process_heredocs(t_cmd *cmds, char **env, int last_exit)
+int	handle_heredoc(char *delimiter, t_shell *shell)
 {
-	t_cmd	*cmd;
-	t_redir	*redir;
+	char	*body;
+	int		fd;
 
-	cmd = cmds;
-	while (cmd)
-	{
-		redir = cmd->redirs;
-		while (redir)
-		{
-			if (redir->type == REDIR_HEREDOC)
-			{
-				if (cmd->heredoc_fd >= 0)
-					close(cmd->heredoc_fd);
-				cmd->heredoc_fd = handle_heredoc(redir->target,
-						env, last_exit);
-			}
-			redir = redir->next;
-		}
-		cmd = cmd->next;
-	}
+	body = heredoc_body(delimiter);
+	if (!body)
+		return (-1);
+	fd = heredoc_replay(delimiter, body, shell);
+	free(body);
+	return (fd);
 }
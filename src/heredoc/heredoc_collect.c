@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_collect.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:22:25 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:27:44 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Bodies read ahead go out first, in source order. A streamed heredoc
+ * is left to the pump, every other one is read here*/
+static void	hd_take(t_redir *redir, t_hd_walk *w)
+{
+	if (w->err || !redir->target)
+		return ;
+	if (w->next < w->bodies->len)
+	{
+		redir->body = w->bodies->v[w->next];
+		w->bodies->v[w->next] = NULL;
+	}
+	else if (w->tree->type != ND_PIPELINE
+		|| !heredoc_stream_wanted(w->tree->cmds, redir, w->shell))
+	{
+		redir->body = heredoc_body(redir->target);
+		w->err = !redir->body;
+	}
+	w->next++;
+}
+
+static void	hd_redirs(t_redir *redir, t_hd_walk *w)
+{
+	while (redir)
+	{
+		if (redir->type == REDIR_HEREDOC)
+			hd_take(redir, w);
+		redir = redir->next;
+	}
+}
+
+static void	hd_walk(t_node *node, t_hd_walk *w)
+{
+	t_cmd	*cmd;
+
+	if (!node)
+		return ;
+	cmd = node->cmds;
+	if (node->type == ND_FUNC)
+		cmd = node->func->body;
+	while (cmd)
+	{
+		hd_walk(cmd->body, w);
+		hd_redirs(cmd->redirs, w);
+		cmd = cmd->next;
+	}
+	hd_walk(node->left, w);
+	hd_walk(node->right, w);
+	hd_walk(node->alt, w);
+}
+
+/*Gives every heredoc of the tree its body before anything runs, so a
+ * branch that is skipped has still consumed its lines, and a loop body
+ * replays the same ones. Returns 1 when ^C cut a body short*/
+int	heredoc_attach(t_node *tree, t_shell *shell)
+{
+	t_hd_walk	w;
+
+	w.bodies = &shell->hd_bodies;
+	w.next = 0;
+	w.err = 0;
+	w.tree = tree;
+	w.shell = shell;
+	hd_walk(tree, &w);
+	heredoc_bodies_clear(shell);
+	if (w.err)
+		shell->exit_code = 130;
+	return (w.err);
+}
+
+/*The line stops inside a clause, so the next lines may be heredoc
+ * bodies: read the ones not read yet before the parse reads on.
+ * Returns 1 when ^C cut a body short*/
+int	heredoc_pending(t_token *tok, t_shell *shell)
+{
+	int	seen;
+
+	seen = 0;
+	while (tok)
+	{
+		if (tok->type == TK_HEREDOC && tok->next
+			&& tok->next->type == TK_WORD && seen++ >= shell->hd_bodies.len
+			&& argv_push(&shell->hd_bodies, heredoc_body(tok->next->value)))
+		{
+			shell->exit_code = 130;
+			return (1);
+		}
+		tok = tok->next;
+	}
+	return (0);
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_fd.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:53:13 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:05:55 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static int	hd_spill_open(void)
+{
+	int	fd;
+
+	fd = anon_file("minishell-heredoc");
+	if (fd < 0)
+		perror("minishell: heredoc");
+	return (fd);
+}
+
+static int	hd_flush(t_hd_ctx *ctx)
+{
+	if (write_all(ctx->fd, ctx->body.data, ctx->body.len))
+	{
+		perror("minishell: heredoc");
+		return (1);
+	}
+	ctx->body.len = 0;
+	return (0);
+}
+
+/*Queues bytes of the body. Only once it outgrows HD_SPILL_SIZE is it
+ * moved to the spill file, one big write at a time*/
+int	heredoc_write(t_hd_ctx *ctx, char *str, size_t len)
+{
+	if (buf_append(&ctx->body, str, len))
+		return (1);
+	if (ctx->body.len < HD_SPILL_SIZE)
+		return (0);
+	if (ctx->fd < 0)
+		ctx->fd = hd_spill_open();
+	if (ctx->fd < 0)
+		return (1);
+	return (hd_flush(ctx));
+}
+
+/*Returns the read end of a pipe already holding the whole body, or -1
+ * if it does not fit the pipe buffer (the write must never block)*/
+static int	hd_pipe(t_buf *body)
+{
+	int	fds[2];
+	int	pipe_size;
+
+	if (body->len > HD_PIPE_MAX || pipe2(fds, O_CLOEXEC) < 0)
+		return (-1);
+	pipe_size = fcntl(fds[1], F_GETPIPE_SZ);
+	if (pipe_size < 0 || (size_t)pipe_size < body->len
+		|| write_all(fds[1], body->data, body->len))
+	{
+		close(fds[0]);
+		close(fds[1]);
+		return (-1);
+	}
+	close(fds[1]);
+	return (fds[0]);
+}
+
+/*Gives the finished body to the command: a pipe when it fits the pipe
+ * buffer, otherwise a memfd rewound to the start*/
+int	heredoc_deliver(t_hd_ctx *ctx)
+{
+	int	fd;
+
+	if (ctx->fd < 0)
+	{
+		fd = hd_pipe(&ctx->body);
+		if (fd >= 0)
+			return (buf_free(&ctx->body), fd);
+		ctx->fd = hd_spill_open();
+	}
+	if (ctx->fd < 0 || hd_flush(ctx) || lseek(ctx->fd, 0, SEEK_SET) < 0)
+	{
+		if (ctx->fd >= 0)
+			close(ctx->fd);
+		return (buf_free(&ctx->body), -1);
+	}
+	buf_free(&ctx->body);
+	return (ctx->fd);
+}
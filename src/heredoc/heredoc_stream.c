@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_stream.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:55:57 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:01:58 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Called instead of handle_heredoc() for a streamed body: the command
+ * gets the read end now, the pump takes the write end when it starts*/
+int	heredoc_stream_open(char *delimiter, t_shell *shell)
+{
+	int	fds[2];
+
+	if (pipe2(fds, O_CLOEXEC) < 0)
+	{
+		perror("minishell: heredoc");
+		return (-1);
+	}
+	shell->hd_stream.delim = heredoc_remove_quotes(delimiter);
+	shell->hd_stream.expand = !heredoc_has_quotes(delimiter);
+	shell->hd_stream.fd = fds[1];
+	return (fds[0]);
+}
+
+/*Once the consumer is gone the write end is dropped, but the body is
+ * still read up to the delimiter so the script stays in sync*/
+static void	pump_flush(t_hd_stream *st, t_buf *out)
+{
+	if (st->fd >= 0 && out->len
+		&& write_all(st->fd, out->data, out->len))
+	{
+		close(st->fd);
+		st->fd = -1;
+	}
+	out->len = 0;
+}
+
+static void	pump_line(t_hd_stream *st, t_buf *out, char *line,
+		t_shell *shell)
+{
+	char	*expanded;
+
+	expanded = line;
+	if (st->expand)
+		expanded = expand_vars(line, shell);
+	if (st->fd >= 0 && expanded)
+	{
+		if (buf_append(out, expanded, ft_strlen(expanded))
+			|| buf_append(out, "\n", 1))
+			out->len = 0;
+	}
+	if (expanded != line)
+		free(expanded);
+	if (out->len >= HD_STREAM_CHUNK)
+		pump_flush(st, out);
+}
+
+/*Child side: copies the script input into the pipe line by line,
+ * expanding on the fly. Memory is bounded by one line plus one chunk*/
+static void	hd_pump(t_hd_stream *st, t_shell *shell)
+{
+	t_reader	rd;
+	t_buf		out;
+	char		*line;
+
+	signal(SIGPIPE, SIG_IGN);
+	close_heredoc_fds(shell->s_cmds);
+	buf_init(&out);
+	reader_init(&rd, STDIN_FILENO);
+	reader_share(&rd, READER_BUFSZ);
+	line = reader_line(&rd);
+	while (line && ft_strcmp(line, st->delim) != 0)
+	{
+		pump_line(st, &out, line, shell);
+		free(line);
+		line = reader_line(&rd);
+	}
+	if (!line)
+		heredoc_eof_warning(st->delim);
+	reader_unread(&rd);
+	pump_flush(st, &out);
+	free(line);
+	buf_free(&out);
+	free(st->delim);
+	cleanup_exit_child(shell, 0);
+}
+
+/*Forks the pump before any consumer starts, so the parent can drop the
+ * write end right away and only the pump keeps the pipe open*/
+void	heredoc_stream_start(t_shell *shell)
+{
+	t_hd_stream	*st;
+
+	st = &shell->hd_stream;
+	if (st->fd < 0)
+		return ;
+	st->pid = fork();
+	if (st->pid == 0)
+		hd_pump(st, shell);
+	if (st->pid < 0)
+		perror("minishell: heredoc");
+	close(st->fd);
+	st->fd = -1;
+	free(st->delim);
+	st->delim = NULL;
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_stream_utils.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:55:58 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 13:26:05 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Streaming only applies to script input and only to the last heredoc
+ * of the pipeline: the end of its body is where the next line starts*/
+int	heredoc_stream_wanted(t_cmd *cmds, t_redir *redir, t_shell *shell)
+{
+	t_redir	*last;
+	t_redir	*cur;
+
+	if (isatty(STDIN_FILENO) || shell->hd_stream.fd >= 0
+		|| !env_flag(shell->env_vars, "MINISHELL_HEREDOC_STREAM"))
+		return (0);
+	last = NULL;
+	while (cmds)
+	{
+		cur = cmds->redirs;
+		while (cur)
+		{
+			if (cur->type == REDIR_HEREDOC)
+				last = cur;
+			cur = cur->next;
+		}
+		cmds = cmds->next;
+	}
+	return (redir == last);
+}
+
+void	close_heredoc_fds(t_cmd *cmds)
+{
+	while (cmds)
+	{
+		if (cmds->heredoc_fd >= 0)
+			close(cmds->heredoc_fd);
+		cmds->heredoc_fd = -1;
+		cmds = cmds->next;
+	}
+}
+
+/*The shell must not read its next line before the pump has consumed
+ * the whole body. Our own read ends go first so it cannot block on us*/
+void	heredoc_stream_finish(t_cmd *cmds, t_shell *shell)
+{
+	if (shell->hd_stream.pid <= 0)
+		return ;
+	close_heredoc_fds(cmds);
+	while (waitpid(shell->hd_stream.pid, NULL, 0) < 0 && errno == EINTR)
+		;
+	shell->hd_stream.pid = -1;
+}
+
+void	heredoc_bodies_clear(t_shell *shell)
+{
+	int	i;
+
+	i = 0;
+	while (i < shell->hd_bodies.len)
+		free(shell->hd_bodies.v[i++]);
+	free(shell->hd_bodies.v);
+	ft_bzero(&shell->hd_bodies, sizeof(t_argv));
+}
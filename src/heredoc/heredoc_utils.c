@@ -6,7 +6,7 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/02/20 18:00:00 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/02/20 18:00:00 by fshiniti         ###   ########.fr       */
+/*   Updated: 2026/10/19 13:26:05 by fshiniti         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -26,31 +26,27 @@ int	heredoc_has_quotes(char *delimiter)
 	return (0);
 }
 
+/*Quote removal on the raw delimiter: 'EOF', "EOF" and E"O"F all end
+ * the body at a line reading EOF*/
 char	*heredoc_remove_quotes(char *delimiter)
 {
-	int		len;
-	char	*clean;
+	t_buf	clean;
+	char	quote;
+	int		i;
 
-	len = ft_strlen(delimiter);
-	if (len >= 2 && ((delimiter[0] == '\'' && delimiter[len - 1] == '\'')
-			|| (delimiter[0] == '"' && delimiter[len - 1] == '"')))
+	buf_init(&clean);
+	quote = 0;
+	i = -1;
+	while (delimiter[++i])
 	{
-		clean = ft_substr(delimiter, 1, len - 2);
-		return (clean);
+		if (!quote && (delimiter[i] == '\'' || delimiter[i] == '"'))
+			quote = delimiter[i];
+		else if (quote && delimiter[i] == quote)
+			quote = 0;
+		else if (buf_append(&clean, &delimiter[i], 1))
+			return (buf_free(&clean), NULL);
 	}
-	return (ft_strdup(delimiter));
-}
-
-char	*heredoc_gen_temp_filename(void)
-{
-	static int	counter = 0;
-	char		*num;
-	char		*filename;
-
-	num = ft_itoa(counter++);
-	filename = ft_strjoin(".heredoc_tmp_", num);
-	free(num);
-	return (filename);
+	return (buf_release(&clean));
 }
 
 void	heredoc_eof_warning(char *delimiter)
@@ -61,27 +57,30 @@ void	heredoc_eof_warning(char *delimiter)
 	ft_putstr_fd("')\n", 2);
 }
 
-char	*heredoc_read_line(void)
+/*Bodies were read when the line was parsed. Only a streamed heredoc,
+ * or a tree nobody attached bodies to, reads stdin from here*/
+void	process_heredocs(t_cmd *cmds, t_shell *shell)
 {
-	char	buffer[1024];
-	int		i;
-	int		ret;
+	t_cmd	*cmd;
+	t_redir	*r;
 
-	i = 0;
-	while (i < 1023)
+	cmd = cmds;
+	while (cmd)
 	{
-		ret = read(STDIN_FILENO, &buffer[i], 1);
-		if (ret < 0)
-			return (NULL);
-		if (ret == 0 || buffer[i] == '\n')
+		r = cmd->redirs;
+		while (r)
 		{
-			buffer[i] = '\0';
-			if (ret == 0 && i == 0)
-				return (NULL);
-			return (ft_strdup(buffer));
+			if (r->type == REDIR_HEREDOC && cmd->heredoc_fd >= 0)
+				close(cmd->heredoc_fd);
+			if (r->type == REDIR_HEREDOC && r->body)
+				cmd->heredoc_fd = heredoc_replay(r->target, r->body, shell);
+			else if (r->type == REDIR_HEREDOC
+				&& heredoc_stream_wanted(cmds, r, shell))
+				cmd->heredoc_fd = heredoc_stream_open(r->target, shell);
+			else if (r->type == REDIR_HEREDOC)
+				cmd->heredoc_fd = handle_heredoc(r->target, shell);
+			r = r->next;
 		}
-		i++;
+		cmd = cmd->next;
 	}
-	buffer[i] = '\0';
-	return (ft_strdup(buffer));
 }
@@ -6,7 +6,7 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 00:30:25 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/02/18 22:01:25 by fshiniti         ###   ########.fr       */
+/*   Updated: 2026/10/19 12:20:33 by fshiniti         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,7 +25,12 @@ static void	handle_redir_out(t_token **tokens, char *line, int *i)
 
 static void	handle_redir_in(t_token **tokens, char *line, int *i)
 {
-	if (line[*i + 1] == '<')
+	if (line[*i + 1] == '<' && line[*i + 2] == '<')
+	{
+		token_add_back(tokens, new_token("<<<", TK_HERESTR));
+		(*i) += 2;
+	}
+	else if (line[*i + 1] == '<')
 	{
 		token_add_back(tokens, new_token("<<", TK_HEREDOC));
 		(*i)++;
@@ -34,34 +39,54 @@ static void	handle_redir_in(t_token **tokens, char *line, int *i)
 		token_add_back(tokens, new_token("<", TK_REDIR_IN));
 }
 
-static void	process_char(t_token **tokens, char *line, int *i,
-		t_shell *shell)
+/*Pipes, fan-out, list operators and parentheses. Returns 0 when
+ * line[*i] is none of them*/
+static int	handle_control(t_token **tokens, char *line, int *i)
+{
+	if (line[*i] == '|' && line[*i + 1] == '|')
+		token_add_back(tokens, new_token("||", TK_OR));
+	else if (line[*i] == '&' && line[*i + 1] == '&')
+		token_add_back(tokens, new_token("&&", TK_AND));
+	else if (line[*i] == '|' && line[*i + 1] == '+')
+		token_add_back(tokens, new_token("|+", TK_FANOUT));
+	else if (line[*i] == '|')
+		token_add_back(tokens, new_token("|", TK_PIPE));
+	else if (line[*i] == ';')
+		token_add_back(tokens, new_token(";", TK_SEMI));
+	else if (line[*i] == '(')
+		token_add_back(tokens, new_token("(", TK_LPAREN));
+	else if (line[*i] == ')')
+		token_add_back(tokens, new_token(")", TK_RPAREN));
+	else
+		return (0);
+	if (((line[*i] == '|' || line[*i] == '&') && line[*i + 1] == line[*i])
+		|| (line[*i] == '|' && line[*i + 1] == '+'))
+		(*i)++;
+	return (1);
+}
+
+/*<( and >( start a process substitution word, not a redirection*/
+static void	process_char(t_token **tokens, char *line, int *i)
 {
 	char	*word;
-	t_token	*tok;
-	int		quoted;
 
-	if (is_space(line[*i]))
+	if (lex_blank(tokens, line, i) || handle_control(tokens, line, i))
 		return ;
-	else if (line[*i] == '|')
-		token_add_back(tokens, new_token("|", TK_PIPE));
-	else if (line[*i] == '<')
+	else if (line[*i] == '<' && line[*i + 1] != '(')
 		handle_redir_in(tokens, line, i);
-	else if (line[*i] == '>')
+	else if (line[*i] == '>' && line[*i + 1] != '(')
 		handle_redir_out(tokens, line, i);
 	else
 	{
-		word = build_full_word(line, i, shell, &quoted);
-		tok = new_token(word, TK_WORD);
-		if (tok && quoted)
-			tok->no_expand = 1;
-		token_add_back(tokens, tok);
+		word = build_raw_word(line, i);
+		if (word)
+			token_add_back(tokens, new_token(word, TK_WORD));
 		free(word);
 		(*i)--;
 	}
 }
 
-t_token	*lexer(char *line, t_shell *shell)
+t_token	*lexer(char *line)
 {
 	t_token	*tokens;
 	int		i;
@@ -72,7 +97,7 @@ t_token	*lexer(char *line, t_shell *shell)
 	i = 0;
 	while (line[i])
 	{
-		process_char(&tokens, line, &i, shell);
+		process_char(&tokens, line, &i);
 		i++;
 	}
 	return (tokens);
@@ -6,7 +6,7 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/26 20:39:41 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/01/23 02:30:50 by fshiniti         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:35:18 by fshiniti         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,7 +19,8 @@ int	is_space(char c)
 
 int	is_special(char c)
 {
-	return (c == '|' || c == '<' || c == '>');
+	return (c == '|' || c == '<' || c == '>' || c == ';' || c == '('
+		|| c == ')');
 }
 
 t_token	*new_token(char *tk_str, t_token_type type)
@@ -36,8 +37,6 @@ t_token	*new_token(char *tk_str, t_token_type type)
 		return (NULL);
 	}
 	node->type = type;
-	node->no_expand = 0;
-	node->in_dquotes = 0;
 	node->next = NULL;
 	return (node);
 }
@@ -6,84 +6,111 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/02/20 23:00:00 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/02/20 23:00:00 by fshiniti         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:42:23 by fshiniti         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
-static int	is_end_of_word(char c)
+/*A lone '&' stays part of the word, only && ends it*/
+static int	is_end_of_word(char *line, int i)
 {
-	return (c == '\0' || is_space(c) || is_special(c));
+	return (line[i] == '\0' || is_space(line[i]) || is_special(line[i])
+		|| (line[i] == '&' && line[i + 1] == '&'));
 }
 
-static char	*extract_quoted_content(char *line, int *i)
+/*Index just past the quoted section starting at line[i]. Inside double
+ * quotes a $(...) or ${...} may hold quotes of its own*/
+int	lex_skip_quote(char *line, int i)
 {
 	char	quote;
-	int		start;
-	char	*content;
 
-	quote = line[*i];
-	(*i)++;
-	start = *i;
-	while (line[*i] && line[*i] != quote)
-		(*i)++;
-	content = ft_substr(line, start, *i - start);
-	if (line[*i] == quote)
-		(*i)++;
-	return (content);
+	quote = line[i++];
+	while (line[i] && line[i] != quote)
+	{
+		if (quote == '"' && line[i] == '$'
+			&& (line[i + 1] == '(' || line[i + 1] == '{'))
+			i = lex_skip_group(line, i + 1);
+		else
+			i++;
+	}
+	if (line[i] == quote)
+		i++;
+	return (i);
 }
 
-static char	*extract_unquoted(char *line, int *i)
+/*Index just past the (...) or {...} group opened at line[i], nested
+ * groups and quotes included. Stops at the end of line if unclosed*/
+int	lex_skip_group(char *line, int i)
 {
-	int		start;
+	char	open;
+	char	close;
+	int		depth;
 
-	start = *i;
-	while (line[*i] && !is_end_of_word(line[*i])
-		&& line[*i] != '\'' && line[*i] != '"')
-		(*i)++;
-	return (ft_substr(line, start, *i - start));
+	open = line[i];
+	close = '}';
+	if (open == '(')
+		close = ')';
+	depth = 0;
+	while (line[i])
+	{
+		if (line[i] == '\'' || line[i] == '"')
+		{
+			i = lex_skip_quote(line, i);
+			continue ;
+		}
+		if (line[i] == open)
+			depth++;
+		else if (line[i] == close && --depth == 0)
+			return (i + 1);
+		i++;
+	}
+	return (i);
 }
 
-static char	*handle_word_part(char *line, int *i, t_shell *shell,
-		int *quoted)
+/*Cuts the next word out of the line exactly as typed, quotes and $
+ * constructs included. Expansion happens later, right before the
+ * command runs, so the same word can be expanded more than once*/
+char	*build_raw_word(char *line, int *i)
 {
-	char	*part;
-	char	*expanded;
+	int	start;
 
-	if (line[*i] == '\'')
-	{
-		*quoted = 1;
-		return (extract_quoted_content(line, i));
-	}
-	else if (line[*i] == '"')
+	start = *i;
+	if ((line[*i] == '<' || line[*i] == '>') && line[*i + 1] == '(')
+		*i = lex_skip_group(line, *i + 1);
+	while (line[*i] && !is_end_of_word(line, *i))
 	{
-		*quoted = 1;
-		part = extract_quoted_content(line, i);
-		expanded = expand_vars(part, shell->env_vars, shell->exit_code);
-		free(part);
-		return (expanded);
+		if (line[*i] == '\'' || line[*i] == '"')
+			*i = lex_skip_quote(line, *i);
+		else if (line[*i] == '$'
+			&& (line[*i + 1] == '(' || line[*i + 1] == '{'))
+			*i = lex_skip_group(line, *i + 1);
+		else
+			(*i)++;
 	}
-	part = extract_unquoted(line, i);
-	expanded = expand_vars(part, shell->env_vars, shell->exit_code);
-	free(part);
-	return (expanded);
+	return (ft_substr(line, start, *i - start));
 }
 
-char	*build_full_word(char *line, int *i, t_shell *shell, int *quoted)
+/*Blanks between tokens. A newline ends a command like ';' does, but
+ * only after a word or ')': after an operator, or with nothing before
+ * it, the command isn't over yet. A '#' where a word would start
+ * comments out the rest of the line*/
+int	lex_blank(t_token **tokens, char *line, int *i)
 {
-	char	*result;
-	char	*part;
-	int		had_quotes;
+	t_token	*last;
 
-	result = ft_strdup("");
-	*quoted = 0;
-	had_quotes = (line[*i] == '\'' || line[*i] == '"');
-	while (line[*i] && !is_end_of_word(line[*i]))
+	if (line[*i] == '#')
 	{
-		part = handle_word_part(line, i, shell, quoted);
-		result = join_and_free(result, part);
+		while (line[*i + 1] && line[*i + 1] != '\n')
+			(*i)++;
+		return (1);
 	}
-	*quoted = had_quotes;
-	return (result);
+	if (line[*i] != '\n')
+		return (is_space(line[*i]));
+	last = *tokens;
+	while (last && last->next)
+		last = last->next;
+	if (last && (last->type == TK_WORD || last->type == TK_RPAREN))
+		token_add_back(tokens, new_token("newline", TK_NEWLINE));
+	return (1);
 }
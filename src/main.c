@@ -6,18 +6,18 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 21:49:22 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/02/19 00:50:49 by fshiniti         ###   ########.fr       */
+/*   Updated: 2026/10/19 13:27:44 by fshiniti         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
-static char	*get_input(t_shell *shell)
+static char	*get_input(t_shell *shell, char *prompt)
 {
 	char	*line;
 
 	if (isatty(STDIN_FILENO))
-		line = readline("minishell> ");
+		line = readline(prompt);
 	else
 		line = read_line();
 	if (g_last_signal == SIGINT)
@@ -28,13 +28,44 @@ static char	*get_input(t_shell *shell)
 	return (line);
 }
 
+/*Runs line, reading on first for as long as it stops inside a clause
+ * or after an operator. The lines are joined with newlines, which end
+ * commands where ';' would*/
+static void	run_input(char *line, t_shell *shell)
+{
+	char	*next;
+	int		more;
+
+	more = 1;
+	while (line && more)
+	{
+		more = 0;
+		process_line(line, shell, &more);
+		if (!more)
+			break ;
+		next = get_input(shell, "> ");
+		if (!next)
+		{
+			ft_putendl_fd("minishell: syntax error: unexpected end of file",
+				2);
+			shell->exit_code = 2;
+			break ;
+		}
+		if (*next)
+			add_history(next);
+		line = join_and_free(join_and_free(line, ft_strdup("\n")), next);
+	}
+	heredoc_bodies_clear(shell);
+	free(line);
+}
+
 static void	shell_loop(t_shell *shell)
 {
 	char	*line;
 
 	while (1)
 	{
-		line = get_input(shell);
+		line = get_input(shell, "minishell> ");
 		if (!line)
 		{
 			if (isatty(STDIN_FILENO))
@@ -45,8 +76,7 @@ static void	shell_loop(t_shell *shell)
 			add_history(line);
 		if (validate_line(line, shell))
 			continue ;
-		process_line(line, shell);
-		free(line);
+		run_input(line, shell);
 	}
 }
 
@@ -55,7 +85,25 @@ static void	init_shell(t_shell *shell, char **envp)
 	shell->env_vars = copy_env(envp);
 	shell->exit_code = 0;
 	shell->s_tokens = NULL;
+	shell->s_tree = NULL;
 	shell->s_cmds = NULL;
+	shell->hd_stream.delim = NULL;
+	shell->hd_stream.expand = 0;
+	shell->hd_stream.fd = -1;
+	shell->hd_stream.pid = -1;
+	shell->procsubs = NULL;
+	ft_bzero(shell->arith_cache, sizeof(shell->arith_cache));
+	shell->arith_next = 0;
+	ft_bzero(shell->glob_cache, sizeof(shell->glob_cache));
+	ft_bzero(shell->funcs, sizeof(shell->funcs));
+	ft_bzero(shell->aliases, sizeof(shell->aliases));
+	shell->frame = NULL;
+	shell->params = NULL;
+	shell->returning = 0;
+	shell->pipe_size = 0;
+	shell->stages = NULL;
+	shell->n_stages = 0;
+	shell->meters = NULL;
 }
 
 int	main(int argc, char **argv, char **envp)
@@ -64,12 +112,20 @@ int	main(int argc, char **argv, char **envp)
 
 	(void)argc;
 	(void)argv;
+	shell.substs = 0;
+	ft_bzero(&shell.hd_bodies, sizeof(t_argv));
 	init_shell(&shell, envp);
 	if (!shell.env_vars)
 		return (1);
+	if (fstat(STDIN_FILENO, &shell.input) < 0)
+		ft_bzero(&shell.input, sizeof(struct stat));
 	shlvl_update(&shell.env_vars);
 	setup_signals();
 	shell_loop(&shell);
+	arith_cache_clear(&shell);
+	glob_cache_clear(&shell);
+	func_clear(&shell);
+	alias_clear(&shell);
 	free_env(shell.env_vars);
 	rl_clear_history();
 	return (shell.exit_code);
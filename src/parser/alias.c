@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   alias.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:50:02 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:50:02 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static unsigned int	alias_hash(char *name)
+{
+	unsigned int	h;
+
+	h = 5381;
+	while (*name)
+		h = h * 33 + (unsigned char)*name++;
+	return (h % ALIAS_TABLE_SIZE);
+}
+
+t_alias	*alias_find(t_shell *shell, char *name)
+{
+	t_alias	*al;
+
+	al = shell->aliases[alias_hash(name)];
+	while (al && ft_strcmp(al->name, name) != 0)
+		al = al->next;
+	return (al);
+}
+
+/*Defines or replaces an alias. The value goes through the lexer here,
+ * once, so using the alias is a splice of ready tokens. No tokens at
+ * all is an alias to nothing. Returns 1 on error*/
+int	alias_set(t_shell *shell, char *name, char *value)
+{
+	t_alias	*al;
+
+	al = ft_calloc(1, sizeof(t_alias));
+	if (!al)
+		return (1);
+	al->name = ft_strdup(name);
+	al->value = ft_strdup(value);
+	al->tokens = lexer(value);
+	if (!al->name || !al->value)
+	{
+		free(al->name);
+		free(al->value);
+		free_tokens(al->tokens);
+		free(al);
+		return (1);
+	}
+	alias_remove(shell, name);
+	al->next = shell->aliases[alias_hash(name)];
+	shell->aliases[alias_hash(name)] = al;
+	return (0);
+}
+
+/*Returns 1 when there was no such alias*/
+int	alias_remove(t_shell *shell, char *name)
+{
+	t_alias	**slot;
+	t_alias	*al;
+
+	slot = &shell->aliases[alias_hash(name)];
+	while (*slot && ft_strcmp((*slot)->name, name) != 0)
+		slot = &(*slot)->next;
+	al = *slot;
+	if (!al)
+		return (1);
+	*slot = al->next;
+	free(al->name);
+	free(al->value);
+	free_tokens(al->tokens);
+	free(al);
+	return (0);
+}
+
+void	alias_clear(t_shell *shell)
+{
+	int	i;
+
+	i = 0;
+	while (i < ALIAS_TABLE_SIZE)
+	{
+		while (shell->aliases[i])
+			alias_remove(shell, shell->aliases[i]->name);
+		i++;
+	}
+}
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_alias.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:50:20 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:50:20 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Puts copies of the alias tokens src in place of tok. tok itself takes
+ * the first one's type and value, so the line stays one list, freed as
+ * one. Returns 1 on error*/
+static int	alias_splice(t_token *tok, t_token *src)
+{
+	t_token	*copy;
+	t_token	*last;
+	char	*value;
+
+	value = ft_strdup(src->value);
+	if (!value)
+		return (1);
+	free(tok->value);
+	tok->value = value;
+	tok->type = src->type;
+	last = tok;
+	while (src->next)
+	{
+		src = src->next;
+		copy = new_token(src->value, src->type);
+		if (!copy)
+			return (1);
+		copy->next = last->next;
+		last->next = copy;
+		last = copy;
+	}
+	return (0);
+}
+
+/*Alias expansion of the word a command starts with, before anything
+ * else looks at it. What an alias gives is looked up again, except for
+ * aliases already expanded there, so alias ls='ls -F' stops at once*/
+void	parse_alias(t_parse *ps)
+{
+	char	*seen[ALIAS_MAX_DEPTH];
+	t_alias	*al;
+	int		n;
+	int		i;
+
+	n = 0;
+	while (n < ALIAS_MAX_DEPTH && ps->tok && ps->tok->type == TK_WORD)
+	{
+		al = alias_find(ps->shell, ps->tok->value);
+		i = 0;
+		while (al && i < n && seen[i] != al->name)
+			i++;
+		if (!al || i < n)
+			return ;
+		seen[n++] = al->name;
+		if (!al->tokens)
+			ps->tok = ps->tok->next;
+		else if (alias_splice(ps->tok, al->tokens))
+			return ;
+	}
+}
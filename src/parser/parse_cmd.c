@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_cmd.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:33:57 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:51:43 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+static int	is_redir(t_token *tok)
+{
+	return (tok && tok->type >= TK_REDIR_IN && tok->type <= TK_HERESTR);
+}
+
+/*A redirection operator and the word it needs*/
+static int	parse_redir(t_parse *ps, t_cmd *cmd)
+{
+	t_token	*op;
+
+	op = ps->tok;
+	if (!op->next || op->next->type != TK_WORD)
+	{
+		ps->tok = op->next;
+		parse_error(ps);
+		return (1);
+	}
+	if (op->type == TK_REDIR_OUT || op->type == TK_APPEND)
+		parse_redir_out(cmd, &ps->tok);
+	else
+		parse_redir_in(cmd, &ps->tok);
+	ps->tok = ps->tok->next;
+	return (0);
+}
+
+/*Words and redirections, in any order, up to the next operator*/
+static int	parse_simple(t_parse *ps, t_cmd *cmd)
+{
+	while (ps->tok && (ps->tok->type == TK_WORD || is_redir(ps->tok)))
+	{
+		if (ps->tok->type == TK_WORD)
+		{
+			cmd_add_word(cmd, ps->tok->value);
+			ps->tok = ps->tok->next;
+		}
+		else if (parse_redir(ps, cmd))
+			return (1);
+	}
+	if (!cmd->words && !cmd->redirs)
+	{
+		parse_error(ps);
+		return (1);
+	}
+	return (0);
+}
+
+/*The rest of a clause parse_clause() started, from the word that
+ * closes it, then the redirections that apply to all of it*/
+static int	parse_compound(t_parse *ps, t_cmd *cmd, char *close)
+{
+	if (!cmd->body || ps->err || (*close && parse_expect(ps, close)))
+		return (1);
+	ps->open--;
+	while (is_redir(ps->tok))
+	{
+		if (parse_redir(ps, cmd))
+			return (1);
+	}
+	if (ps->tok && (ps->tok->type == TK_WORD || ps->tok->type == TK_LPAREN))
+		return (parse_error(ps), 1);
+	return (0);
+}
+
+/*One command of a pipeline. Aliases, and reserved words like '{' or
+ * 'if', are only looked for where a command starts*/
+t_cmd	*parse_command(t_parse *ps)
+{
+	t_cmd	*cmd;
+	char	*close;
+
+	parse_alias(ps);
+	if (parse_list_end(ps))
+	{
+		parse_error(ps);
+		return (NULL);
+	}
+	cmd = new_cmd();
+	if (!cmd)
+		return (NULL);
+	ps->open++;
+	cmd->body = parse_clause(ps, &close);
+	if (!close)
+		ps->open--;
+	if ((close && parse_compound(ps, cmd, close))
+		|| (!close && parse_simple(ps, cmd)))
+	{
+		free_cmds(cmd);
+		return (NULL);
+	}
+	return (cmd);
+}
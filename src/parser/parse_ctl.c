@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_ctl.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:40:26 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:49:25 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*if or elif, up to the fi parse_compound() expects. Each elif nests as
+ * the else branch of the one before*/
+static t_node	*parse_if(t_parse *ps)
+{
+	t_node	*node;
+
+	ps->tok = ps->tok->next;
+	node = parse_list(ps);
+	if (!node || parse_expect(ps, "then"))
+		return (free_tree(node), NULL);
+	node = new_node(ND_IF, node, parse_list(ps), NULL);
+	if (node && parse_word_is(ps, "elif"))
+		node->alt = parse_if(ps);
+	else if (node && parse_word_is(ps, "else"))
+	{
+		ps->tok = ps->tok->next;
+		node->alt = parse_list(ps);
+	}
+	if (node && ps->err)
+		return (free_tree(node), NULL);
+	return (node);
+}
+
+/*while or until, up to done*/
+static t_node	*parse_loop(t_parse *ps)
+{
+	t_node_type	type;
+	t_node		*cond;
+
+	type = ND_WHILE;
+	if (parse_word_is(ps, "until"))
+		type = ND_UNTIL;
+	ps->tok = ps->tok->next;
+	cond = parse_list(ps);
+	if (!cond || parse_expect(ps, "do"))
+		return (free_tree(cond), NULL);
+	return (new_node(type, cond, parse_list(ps), NULL));
+}
+
+/*[in word...] [; | newline], what a for loop has before do. The words
+ * are kept as typed in a t_cmd, for every run of the loop to expand
+ * afresh like a command's. NULL without 'in'*/
+static t_cmd	*for_words(t_parse *ps)
+{
+	t_cmd	*list;
+
+	list = NULL;
+	if (parse_word_is(ps, "in"))
+	{
+		ps->tok = ps->tok->next;
+		list = new_cmd();
+	}
+	while (list && ps->tok && ps->tok->type == TK_WORD)
+	{
+		cmd_add_word(list, ps->tok->value);
+		ps->tok = ps->tok->next;
+	}
+	if (ps->tok && (ps->tok->type == TK_SEMI || ps->tok->type == TK_NEWLINE))
+		ps->tok = ps->tok->next;
+	return (list);
+}
+
+static t_node	*parse_for(t_parse *ps)
+{
+	t_node	*node;
+	t_cmd	*list;
+	char	*name;
+
+	ps->tok = ps->tok->next;
+	if (!ps->tok || ps->tok->type != TK_WORD || !is_valid_key(ps->tok->value)
+		|| ft_strchr(ps->tok->value, '='))
+		return (parse_error(ps), NULL);
+	name = ft_strjoin(ps->tok->value, "=");
+	ps->tok = ps->tok->next;
+	list = for_words(ps);
+	node = NULL;
+	if (name && !parse_expect(ps, "do"))
+		node = new_node(ND_FOR, NULL, parse_list(ps), list);
+	else
+		free_cmds(list);
+	if (!node)
+		free(name);
+	else
+		node->name = name;
+	return (node);
+}
+
+/*Starts the compound command at the next token, parsing it up to the
+ * word that closes it, which *close is set to. Both are NULL when a
+ * simple command starts there instead. A function definition has
+ * nothing left to close*/
+t_node	*parse_clause(t_parse *ps, char **close)
+{
+	t_node_type	type;
+
+	*close = "fi";
+	if (parse_word_is(ps, "if"))
+		return (parse_if(ps));
+	*close = "done";
+	if (parse_word_is(ps, "while") || parse_word_is(ps, "until"))
+		return (parse_loop(ps));
+	if (parse_word_is(ps, "for"))
+		return (parse_for(ps));
+	*close = NULL;
+	if (ps->tok->type != TK_LPAREN && !parse_word_is(ps, "{"))
+		return (parse_funcdef(ps, close));
+	*close = "}";
+	type = ND_GROUP;
+	if (ps->tok->type == TK_LPAREN)
+	{
+		*close = ")";
+		type = ND_SUBSHELL;
+	}
+	ps->tok = ps->tok->next;
+	return (new_node(type, parse_list(ps), NULL, NULL));
+}
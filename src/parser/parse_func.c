@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_func.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:47:18 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:47:18 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Names a function may have: letters, digits and _ - . :, so that it
+ * can't be mistaken for an assignment or need any expanding*/
+static int	func_name_ok(char *name)
+{
+	int	i;
+
+	i = 0;
+	while (name[i] && (ft_isalnum(name[i]) || ft_strchr("_-.:", name[i])))
+		i++;
+	return (i > 0 && !name[i] && !ft_isdigit(name[0]));
+}
+
+static int	clause_starts(t_parse *ps)
+{
+	return (ps->tok && (ps->tok->type == TK_LPAREN
+			|| parse_word_is(ps, "{") || parse_word_is(ps, "if")
+			|| parse_word_is(ps, "while") || parse_word_is(ps, "until")
+			|| parse_word_is(ps, "for")));
+}
+
+/*name ( ) and the compound command that is its body, redirections
+ * included. The body is parsed here once, a t_func shared by the tree
+ * and the function table once defined. Returns NULL with *close left
+ * alone when no definition starts here, *close is "" otherwise*/
+t_node	*parse_funcdef(t_parse *ps, char **close)
+{
+	t_token	*name;
+	t_node	*node;
+
+	name = ps->tok;
+	if (!name->next || name->next->type != TK_LPAREN
+		|| !name->next->next || name->next->next->type != TK_RPAREN)
+		return (NULL);
+	*close = "";
+	ps->tok = name->next->next->next;
+	if (ps->tok && ps->tok->type == TK_NEWLINE)
+		ps->tok = ps->tok->next;
+	if (!func_name_ok(name->value) || !clause_starts(ps))
+		return (parse_error(ps), NULL);
+	node = ft_calloc(1, sizeof(t_node));
+	if (node)
+		node->func = ft_calloc(1, sizeof(t_func));
+	if (!node || !node->func)
+		return (free(node), NULL);
+	node->type = ND_FUNC;
+	node->func->refs = 1;
+	node->func->name = ft_strdup(name->value);
+	node->func->body = parse_command(ps);
+	if (!node->func->name || !node->func->body)
+		return (free_tree(node), NULL);
+	return (node);
+}
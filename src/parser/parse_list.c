@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_list.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:31:01 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 12:20:33 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Wraps the pipeline cmds, joins two parts with an operator, or wraps
+ * the parts of a compound command. What was passed in is freed, and
+ * NULL returned, when a part is missing. A for loop may have no word
+ * list, every other clause but ( ) and { } needs its right side*/
+t_node	*new_node(t_node_type type, t_node *left, t_node *right, t_cmd *cmds)
+{
+	t_node	*node;
+
+	node = NULL;
+	if ((cmds || left || type == ND_FOR)
+		&& (right || type == ND_PIPELINE || type >= ND_SUBSHELL))
+		node = ft_calloc(1, sizeof(t_node));
+	if (!node)
+	{
+		free_tree(left);
+		free_tree(right);
+		free_cmds(cmds);
+		return (NULL);
+	}
+	node->type = type;
+	node->left = left;
+	node->right = right;
+	node->cmds = cmds;
+	return (node);
+}
+
+void	free_tree(t_node *node)
+{
+	if (!node)
+		return ;
+	free_tree(node->left);
+	free_tree(node->right);
+	free_tree(node->alt);
+	free(node->name);
+	func_release(node->func);
+	free_cmds(node->cmds);
+	free(node);
+}
+
+/*Commands joined by '|' or '|+', which marks a fan-out reader*/
+static t_cmd	*parse_pipeline(t_parse *ps)
+{
+	t_cmd	*cmds;
+	t_cmd	*cmd;
+	int		fanout;
+
+	cmds = parse_command(ps);
+	cmd = cmds;
+	while (cmd && ps->tok
+		&& (ps->tok->type == TK_PIPE || ps->tok->type == TK_FANOUT))
+	{
+		fanout = (ps->tok->type == TK_FANOUT);
+		ps->tok = ps->tok->next;
+		ps->open++;
+		cmd->next = parse_command(ps);
+		ps->open--;
+		cmd = cmd->next;
+		if (cmd)
+			cmd->fanout = fanout;
+	}
+	if (!cmd)
+	{
+		free_cmds(cmds);
+		return (NULL);
+	}
+	return (cmds);
+}
+
+/*Pipelines chained by && and ||, which bind equally, left to right*/
+static t_node	*parse_and_or(t_parse *ps)
+{
+	t_node		*node;
+	t_node_type	type;
+
+	node = new_node(ND_PIPELINE, NULL, NULL, parse_pipeline(ps));
+	while (node && ps->tok
+		&& (ps->tok->type == TK_AND || ps->tok->type == TK_OR))
+	{
+		type = ND_OR;
+		if (ps->tok->type == TK_AND)
+			type = ND_AND;
+		ps->tok = ps->tok->next;
+		ps->open++;
+		node = new_node(type, node, new_node(ND_PIPELINE, NULL, NULL,
+					parse_pipeline(ps)), NULL);
+		ps->open--;
+	}
+	return (node);
+}
+
+/*and_or lists separated by ';' or newlines, up to parse_list_end(). A
+ * ';' may end a list but not start it, a newline may do both*/
+t_node	*parse_list(t_parse *ps)
+{
+	t_node	*node;
+
+	if (ps->tok && ps->tok->type == TK_NEWLINE)
+		ps->tok = ps->tok->next;
+	node = parse_and_or(ps);
+	while (node && ps->tok
+		&& (ps->tok->type == TK_SEMI || ps->tok->type == TK_NEWLINE))
+	{
+		ps->tok = ps->tok->next;
+		if (!parse_list_end(ps))
+			node = new_node(ND_SEQ, node, parse_and_or(ps), NULL);
+	}
+	return (node);
+}
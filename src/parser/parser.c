@@ -6,100 +6,103 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 10:29:17 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/01/29 18:19:28 by abroslav         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:51:43 by abroslav         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+
 #include "minishell.h"
 
-static int	check_pipe_syntax(t_token *current)
+/*Reports the first syntax error only, at the token the parser stopped
+ * on. Input running out inside a construct or after an operator is
+ * only an error when no more can be read*/
+void	parse_error(t_parse *ps)
 {
-	if (!current->next || current->next->type == TK_PIPE)
+	if (ps->err)
+		return ;
+	ps->err = 1;
+	if (!ps->tok && ps->open)
 	{
-		ft_putendl_fd(
-			"minishell: syntax error near unexpected token `|'", 2);
-		return (2);
+		if (ps->more)
+			*ps->more = 1;
+		else
+			ft_putendl_fd("minishell: syntax error: unexpected end of file",
+				2);
+		return ;
 	}
-	return (0);
+	ft_putstr_fd("minishell: syntax error near unexpected token `", 2);
+	if (ps->tok)
+		ft_putstr_fd(ps->tok->value, 2);
+	else
+		ft_putstr_fd("newline", 2);
+	ft_putendl_fd("'", 2);
 }
 
-static int	check_redir_syntax(t_token *current)
+/*Whether the next token is the reserved word word. Words are kept as
+ * typed, so a quoted "}" never is one*/
+int	parse_word_is(t_parse *ps, char *word)
 {
-	if (!current->next || current->next->type != TK_WORD)
-	{
-		ft_putendl_fd(
-			"minishell: syntax error near unexpected token `newline'", 2);
-		return (2);
-	}
-	return (0);
+	return (ps->tok && ps->tok->type == TK_WORD
+		&& ft_strcmp(ps->tok->value, word) == 0);
 }
 
-static int	validate_syntax(t_token *tokens)
+/*Where a list stops: the end of the line, or what closes the compound
+ * command it is the body of*/
+int	parse_list_end(t_parse *ps)
 {
-	t_token	*current;
-
-	current = tokens;
-	if (!current)
-		return (0);
-	if (current->type == TK_PIPE)
-	{
-		ft_putendl_fd(
-			"minishell: syntax error near unexpected token `|'", 2);
-		return (2);
-	}
-	while (current)
-	{
-		if (current->type == TK_PIPE && check_pipe_syntax(current))
-			return (2);
-		if ((current->type >= TK_REDIR_IN
-				&& current->type <= TK_HEREDOC)
-			&& check_redir_syntax(current))
-			return (2);
-		current = current->next;
-	}
-	return (0);
+	return (!ps->tok || ps->tok->type == TK_RPAREN
+		|| parse_word_is(ps, "}") || parse_word_is(ps, "then")
+		|| parse_word_is(ps, "elif") || parse_word_is(ps, "else")
+		|| parse_word_is(ps, "fi") || parse_word_is(ps, "do")
+		|| parse_word_is(ps, "done"));
 }
 
-static void	process_token(t_cmd **cmds, t_cmd **cur, t_token **tokens)
+/*Skips word, or ')', which has to come next*/
+int	parse_expect(t_parse *ps, char *word)
 {
-	if ((*tokens)->type == TK_WORD)
-	{
-		if ((*tokens)->value[0] != '\0' || (*tokens)->no_expand
-			|| (*tokens)->in_dquotes)
-			cmd_add_arg(*cur, (*tokens)->value);
-	}
-	else if ((*tokens)->type == TK_PIPE)
+	if (!ps->tok || ft_strcmp(ps->tok->value, word) != 0
+		|| (ps->tok->type != TK_WORD && ps->tok->type != TK_RPAREN))
 	{
-		*cur = new_cmd();
-		cmd_add_back(cmds, *cur);
+		parse_error(ps);
+		return (1);
 	}
-	else if ((*tokens)->type == TK_REDIR_IN
-		|| (*tokens)->type == TK_HEREDOC)
-		parse_redir_in(*cur, tokens);
-	else if ((*tokens)->type == TK_REDIR_OUT
-		|| (*tokens)->type == TK_APPEND)
-		parse_redir_out(*cur, tokens);
+	ps->tok = ps->tok->next;
+	return (0);
 }
 
-t_cmd	*parser(t_token *tokens, t_shell *shell)
+/*Command line grammar, loosest first:
+ *   list     : and_or ((';' | '\n') and_or)* [';' | '\n']
+ *   and_or   : pipeline (('&&' | '||') pipeline)*
+ *   pipeline : command ('|' command)*
+ *   command  : simple | clause redir* | NAME '(' ')' ['\n'] clause redir*
+ *   clause   : '(' list ')' | '{' list '}'
+ *            | 'if' list 'then' list ('elif' list 'then' list)*
+ *              ['else' list] 'fi'
+ *            | ('while' | 'until') list 'do' list 'done'
+ *            | 'for' NAME ['in' word*] [';' | '\n'] 'do' list 'done'
+ * Returns NULL on a syntax error, with $? set to 2. When more is given
+ * and the input stops short of a complete list, *more is set instead*/
+t_node	*parser(t_token *tokens, t_shell *shell, int *more)
 {
-	t_cmd	*cmds;
-	t_cmd	*current_cmd;
+	t_parse	ps;
+	t_node	*tree;
 
 	if (!tokens)
 		return (NULL);
-	if (validate_syntax(tokens) != 0)
+	ps.tok = tokens;
+	ps.err = 0;
+	ps.open = 0;
+	ps.more = more;
+	ps.shell = shell;
+	tree = parse_list(&ps);
+	if (tree && ps.tok)
+		parse_error(&ps);
+	if (ps.err)
 	{
-		shell->exit_code = 2;
+		free_tree(tree);
+		if (!more || !*more)
+			shell->exit_code = 2;
 		return (NULL);
 	}
-	cmds = NULL;
-	current_cmd = new_cmd();
-	cmd_add_back(&cmds, current_cmd);
-	while (tokens)
-	{
-		process_token(&cmds, &current_cmd, &tokens);
-		tokens = tokens->next;
-	}
-	return (cmds);
+	return (tree);
 }
@@ -6,28 +6,12 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/02/20 23:00:00 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/02/24 12:00:00 by fshiniti         ###   ########.fr       */
+/*   Updated: 2026/10/19 13:26:05 by fshiniti         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
-/*
-** Wraps the delimiter in quotes so heredoc_has_quotes() detects it
-** and disables variable expansion inside the heredoc body.
-** Called when the delimiter token came from single quotes (no_expand=1).
-*/
-static char	*quoted_target(char *value)
-{
-	char	*tmp;
-	char	*result;
-
-	tmp = ft_strjoin("'", value);
-	result = ft_strjoin(tmp, "'");
-	free(tmp);
-	return (result);
-}
-
 static t_redir	*new_redir(t_redir_type type)
 {
 	t_redir	*redir;
@@ -37,6 +21,8 @@ static t_redir	*new_redir(t_redir_type type)
 		return (NULL);
 	redir->type = type;
 	redir->target = NULL;
+	redir->file = NULL;
+	redir->body = NULL;
 	redir->next = NULL;
 	return (redir);
 }
@@ -48,6 +34,8 @@ void	parse_redir_in(t_cmd *current_cmd, t_token **tokens)
 
 	if ((*tokens)->type == TK_HEREDOC)
 		type = REDIR_HEREDOC;
+	else if ((*tokens)->type == TK_HERESTR)
+		type = REDIR_HERESTR;
 	else
 		type = REDIR_IN;
 	redir = new_redir(type);
@@ -55,12 +43,7 @@ void	parse_redir_in(t_cmd *current_cmd, t_token **tokens)
 		return ;
 	*tokens = (*tokens)->next;
 	if (*tokens && (*tokens)->type == TK_WORD)
-	{
-		if (type == REDIR_HEREDOC && (*tokens)->no_expand)
-			redir->target = quoted_target((*tokens)->value);
-		else
-			redir->target = ft_strdup((*tokens)->value);
-	}
+		redir->target = ft_strdup((*tokens)->value);
 	redir_add_back(&current_cmd->redirs, redir);
 }
 
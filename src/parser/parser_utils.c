@@ -6,7 +6,7 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 09:32:49 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/01/09 22:15:18 by fshiniti         ###   ########.fr       */
+/*   Updated: 2026/10/19 12:20:33 by fshiniti         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,10 +19,14 @@ t_cmd	*new_cmd(void)
 	cmd = malloc(sizeof(t_cmd));
 	if (!cmd)
 		return (NULL);
+	cmd->words = NULL;
 	cmd->args = NULL;
 	cmd->redirs = NULL;
 	cmd->limits = NULL;
 	cmd->heredoc_fd = -1;
+	cmd->body = NULL;
+	cmd->fanout = 0;
+	cmd->tee_fd = -1;
 	cmd->next = NULL;
 	return (cmd);
 }
@@ -56,26 +60,26 @@ static int	argv_len(char **argv)
 	return (i);
 }
 
-void	cmd_add_arg(t_cmd *cmd, char *arg)
+void	cmd_add_word(t_cmd *cmd, char *word)
 {
 	int		len;
 	char	**new_argv;
 	int		i;
 
-	len = argv_len(cmd->args);
+	len = argv_len(cmd->words);
 	new_argv = malloc(sizeof(char *) * (len + 2));
 	if (!new_argv)
 		return ;
 	i = 0;
 	while (i < len)
 	{
-		new_argv[i] = cmd->args[i];
+		new_argv[i] = cmd->words[i];
 		i++;
 	}
-	new_argv[len] = ft_strdup(arg);
+	new_argv[len] = ft_strdup(word);
 	new_argv[len + 1] = NULL;
-	free(cmd->args);
-	cmd->args = new_argv;
+	free(cmd->words);
+	cmd->words = new_argv;
 }
 
 void	redir_add_back(t_redir **list, t_redir *new_node)
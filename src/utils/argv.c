@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   argv.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:01:14 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:01:14 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Appends str (ownership is taken) and keeps the vector NULL terminated.
+ * Capacity doubles, so building a long argv stays linear*/
+int	argv_push(t_argv *av, char *str)
+{
+	char	**new_v;
+	int		new_cap;
+
+	if (!str)
+		return (1);
+	if (av->len + 2 > av->cap)
+	{
+		new_cap = av->cap * 2;
+		if (new_cap < ARGV_MIN_CAP)
+			new_cap = ARGV_MIN_CAP;
+		new_v = malloc(sizeof(char *) * new_cap);
+		if (!new_v)
+			return (free(str), 1);
+		if (av->v)
+			ft_memcpy(new_v, av->v, sizeof(char *) * av->len);
+		free(av->v);
+		av->v = new_v;
+		av->cap = new_cap;
+	}
+	av->v[av->len++] = str;
+	av->v[av->len] = NULL;
+	return (0);
+}
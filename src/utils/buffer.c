@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   buffer.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:50:32 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 10:50:32 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+void	buf_init(t_buf *buf)
+{
+	buf->data = NULL;
+	buf->len = 0;
+	buf->cap = 0;
+}
+
+/*Grows the storage geometrically so appends stay amortised O(1).
+ * Always keeps room for a terminating '\0'. Returns 1 on malloc failure*/
+int	buf_reserve(t_buf *buf, size_t extra)
+{
+	char	*new_data;
+	size_t	new_cap;
+
+	if (buf->len + extra + 1 <= buf->cap)
+		return (0);
+	new_cap = buf->cap;
+	if (new_cap < BUF_MIN_CAP)
+		new_cap = BUF_MIN_CAP;
+	while (new_cap < buf->len + extra + 1)
+		new_cap *= 2;
+	new_data = malloc(new_cap);
+	if (!new_data)
+		return (1);
+	if (buf->data)
+		ft_memcpy(new_data, buf->data, buf->len);
+	free(buf->data);
+	buf->data = new_data;
+	buf->cap = new_cap;
+	return (0);
+}
+
+int	buf_append(t_buf *buf, const char *src, size_t n)
+{
+	if (buf_reserve(buf, n))
+		return (1);
+	ft_memcpy(buf->data + buf->len, src, n);
+	buf->len += n;
+	buf->data[buf->len] = '\0';
+	return (0);
+}
+
+/*Hands the '\0' terminated contents to the caller and resets the buffer*/
+char	*buf_release(t_buf *buf)
+{
+	char	*data;
+
+	if (buf_reserve(buf, 0))
+		return (NULL);
+	data = buf->data;
+	data[buf->len] = '\0';
+	buf_init(buf);
+	return (data);
+}
+
+void	buf_free(t_buf *buf)
+{
+	free(buf->data);
+	buf_init(buf);
+}
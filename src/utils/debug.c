@@ -6,7 +6,7 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 13:36:42 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/01/06 18:54:54 by fshiniti         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:01:58 by fshiniti         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,8 +18,6 @@ void	print_tokens(t_token *tokens)
 	while (tokens)
 	{
 		printf("type=%d, value=\"%s\"\n", tokens->type, tokens->value);
-		if (tokens->no_expand)
-			printf(" [NO_EXPAND]\n");
 		tokens = tokens->next;
 	}
 	printf("\n");
@@ -37,6 +35,8 @@ static void	print_redir(t_redir *redir)
 			printf(" >> %s\n", redir->target);
 		else if (redir->type == REDIR_HEREDOC)
 			printf(" << %s\n", redir->target);
+		else if (redir->type == REDIR_HERESTR)
+			printf(" <<< %s\n", redir->target);
 		redir = redir->next;
 	}
 }
@@ -49,12 +49,12 @@ void	print_cmds(t_cmd *cmd)
 	while (cmd)
 	{
 		printf("--- CMD ---\n");
-		if (cmd->args)
+		if (cmd->words)
 		{
 			i = 0;
-			while (cmd->args[i])
+			while (cmd->words[i])
 			{
-				printf(" argv[%d] = \"%s\"\n", i, cmd->args[i]);
+				printf(" argv[%d] = \"%s\"\n", i, cmd->words[i]);
 				i++;
 			}
 		}
@@ -6,7 +6,7 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/12/27 18:37:44 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/02/16 16:39:37 by abroslav         ###   ########.fr       */
+/*   Updated: 2026/10/19 13:26:05 by abroslav         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,9 +21,10 @@ void	free_all(t_shell *shell)
 		free_tokens(shell->s_tokens);
 		shell->s_tokens = NULL;
 	}
-	if (shell->s_cmds)
+	if (shell->s_tree)
 	{
-		free_cmds(shell->s_cmds);
+		free_tree(shell->s_tree);
+		shell->s_tree = NULL;
 		shell->s_cmds = NULL;
 	}
 	if (shell->env_vars)
@@ -31,6 +32,10 @@ void	free_all(t_shell *shell)
 		free_env(shell->env_vars);
 		shell->env_vars = NULL;
 	}
+	arith_cache_clear(shell);
+	glob_cache_clear(shell);
+	func_clear(shell);
+	alias_clear(shell);
 	rl_clear_history();
 }
 
@@ -57,6 +62,8 @@ static void	free_redirs(t_redir *redir)
 		next = redir->next;
 		if (redir->target)
 			free(redir->target);
+		free(redir->file);
+		free(redir->body);
 		free(redir);
 		redir = next;
 	}
@@ -72,6 +79,7 @@ void	free_cmds(t_cmd *cmds)
 	{
 		tmp = cmds;
 		cmds = cmds->next;
+		free_tab(tmp->words);
 		if (tmp->args)
 		{
 			i = 0;
@@ -83,6 +91,7 @@ void	free_cmds(t_cmd *cmds)
 			free_redirs(tmp->redirs);
 		if (tmp->heredoc_fd >= 0)
 			close(tmp->heredoc_fd);
+		free_tree(tmp->body);
 		free(tmp);
 	}
 }
@@ -93,9 +102,13 @@ void	cleanup_exit_child(t_shell *shell, int exit_code)
 		exit(exit_code);
 	if (shell->s_tokens)
 		free_tokens(shell->s_tokens);
-	if (shell->s_cmds)
-		free_cmds(shell->s_cmds);
+	if (shell->s_tree)
+		free_tree(shell->s_tree);
 	if (shell->env_vars)
 		free_env(shell->env_vars);
+	arith_cache_clear(shell);
+	glob_cache_clear(shell);
+	func_clear(shell);
+	alias_clear(shell);
 	exit(exit_code);
 }
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   io_utils.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:53:13 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 11:05:55 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*write() until everything is out, retrying short writes and EINTR.
+ * Returns 0 on success, 1 on error*/
+int	write_all(int fd, const char *src, size_t n)
+{
+	ssize_t	ret;
+
+	while (n > 0)
+	{
+		ret = write(fd, src, n);
+		if (ret < 0 && errno == EINTR)
+			continue ;
+		if (ret <= 0)
+			return (1);
+		src += ret;
+		n -= ret;
+	}
+	return (0);
+}
+
+/*read() until EOF straight into the spare room of out, growing it
+ * READ_ALL_CHUNK at a time. Returns 0 on success, 1 on error*/
+int	read_all(int fd, t_buf *out)
+{
+	ssize_t	ret;
+
+	while (1)
+	{
+		if (buf_reserve(out, READ_ALL_CHUNK))
+			return (1);
+		ret = read(fd, out->data + out->len, out->cap - out->len - 1);
+		if (ret < 0 && errno == EINTR)
+			continue ;
+		if (ret < 0)
+			return (1);
+		if (ret == 0)
+			return (0);
+		out->len += ret;
+		out->data[out->len] = '\0';
+	}
+}
+
+/*Anonymous in-memory file, so nothing is ever created in the cwd.
+ * Kernels without memfd_create() get an unlinked O_TMPFILE on tmpfs*/
+int	anon_file(char *name)
+{
+	int	fd;
+
+	fd = memfd_create(name, MFD_CLOEXEC);
+	if (fd < 0)
+		fd = open(ANON_FILE_DIR, O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+	if (fd < 0)
+		fd = open("/tmp", O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+	return (fd);
+}
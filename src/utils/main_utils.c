@@ -6,7 +6,7 @@
 /*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/02/20 23:00:00 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/02/20 23:00:00 by fshiniti         ###   ########.fr       */
+/*   Updated: 2026/10/19 13:27:44 by fshiniti         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -65,22 +65,32 @@ int	validate_line(char *line, t_shell *shell)
 	return (0);
 }
 
-void	process_line(char *line, t_shell *shell)
+/*One lex and one parse for the whole line, however many pipelines its
+ * lists hold. With more given, a line that stops short of a complete
+ * list sets *more and runs nothing, for the caller to read on*/
+void	process_line(char *line, t_shell *shell, int *more)
 {
 	t_token	*tokens;
-	t_cmd	*cmds;
+	t_node	*tree;
 
-	tokens = lexer(line, shell);
+	tokens = lexer(line);
 	if (tokens)
 	{
 		shell->s_tokens = tokens;
-		cmds = parser(tokens, shell);
-		if (cmds)
+		tree = parser(tokens, shell, more);
+		if (!tree && more && *more && heredoc_pending(tokens, shell))
+			*more = 0;
+		if (tree && heredoc_attach(tree, shell))
 		{
-			shell->s_cmds = cmds;
-			executor(cmds, shell);
-			free_cmds(cmds);
-			shell->s_cmds = NULL;
+			free_tree(tree);
+			tree = NULL;
+		}
+		if (tree)
+		{
+			shell->s_tree = tree;
+			exec_tree(tree, shell);
+			free_tree(tree);
+			shell->s_tree = NULL;
 		}
 		free_tokens(tokens);
 		shell->s_tokens = NULL;
@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   reader.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:50:32 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 10:57:32 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+void	reader_init(t_reader *rd, int fd)
+{
+	rd->fd = fd;
+	rd->pos = 0;
+	rd->len = 0;
+	rd->chunk = READER_BUFSZ;
+}
+
+/*For an fd the shell keeps reading after us (its own script input):
+ * a seekable fd is read in blocks and the excess given back with
+ * reader_unread(), anything else has to be read one byte at a time*/
+void	reader_share(t_reader *rd, ssize_t chunk)
+{
+	rd->chunk = chunk;
+	if (lseek(rd->fd, 0, SEEK_CUR) < 0)
+		rd->chunk = 1;
+}
+
+void	reader_unread(t_reader *rd)
+{
+	if (rd->len > rd->pos)
+		lseek(rd->fd, rd->pos - rd->len, SEEK_CUR);
+	rd->pos = 0;
+	rd->len = 0;
+}
+
+/*Refills the block with one read(). Returns 0 on end of input*/
+int	reader_fill(t_reader *rd)
+{
+	rd->len = read(rd->fd, rd->data, rd->chunk);
+	while (rd->len < 0 && errno == EINTR)
+		rd->len = read(rd->fd, rd->data, rd->chunk);
+	rd->pos = 0;
+	if (rd->len <= 0)
+	{
+		rd->len = 0;
+		return (0);
+	}
+	return (1);
+}
+
+/*Returns the next byte of the stream or -1 on end of input*/
+int	reader_getc(t_reader *rd)
+{
+	if (rd->pos >= rd->len && !reader_fill(rd))
+		return (-1);
+	return ((unsigned char)rd->data[rd->pos++]);
+}
+
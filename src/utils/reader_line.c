@@ -0,0 +1,42 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   reader_line.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: fshiniti <fshiniti@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:55:08 by fshiniti          #+#    #+#             */
+/*   Updated: 2026/10/19 10:55:08 by fshiniti         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/*Next line without its '\n', NULL once the input is exhausted.
+ * Whole runs of the block are copied at once, not byte by byte*/
+char	*reader_line(t_reader *rd)
+{
+	t_buf	line;
+	char	*nl;
+	size_t	n;
+	int		got;
+
+	buf_init(&line);
+	got = 0;
+	while (rd->pos < rd->len || reader_fill(rd))
+	{
+		got = 1;
+		n = rd->len - rd->pos;
+		nl = ft_memchr(rd->data + rd->pos, '\n', n);
+		if (nl)
+			n = nl - (rd->data + rd->pos);
+		if (buf_append(&line, rd->data + rd->pos, n))
+			return (buf_free(&line), NULL);
+		rd->pos += n + (nl != NULL);
+		if (nl)
+			break ;
+	}
+	if (!got)
+		return (NULL);
+	return (buf_release(&line));
+}
@@ -6,19 +6,31 @@
 /*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/27 15:34:31 by abroslav          #+#    #+#             */
-/*   Updated: 2026/02/02 13:44:14 by abroslav         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:49:25 by abroslav         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
-char	*special_expand_params(char c, int last_exit)
+/*$?, $$, $#, $@, $* and $0 to $9, malloc'd*/
+char	*special_expand_params(char c, t_shell *shell)
 {
+	char	*value;
+
 	if (c == '?')
-		return (ft_itoa(last_exit));
+		return (ft_itoa(shell->exit_code));
 	if (c == '$')
 		return (ft_itoa(getpid()));
-	return (NULL);
+	if (c == '#')
+		return (ft_itoa(get_matrix_len(shell->params)));
+	if (c == '@' || c == '*')
+		return (positional_join(shell));
+	if (c == '0')
+		return (ft_strdup("minishell"));
+	value = positional_get(shell, c - '0');
+	if (!value)
+		value = "";
+	return (ft_strdup(value));
 }
 
 int	ft_strcmp(const char *s1, const char *s2)
@@ -6,7 +6,7 @@
 /*   By: abroslav <abroslav@student.42porto.com>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/02/20 23:00:00 by fshiniti          #+#    #+#             */
-/*   Updated: 2026/02/20 23:00:00 by fshiniti         ###   ########.fr       */
+/*   Updated: 2026/10/19 11:11:57 by fshiniti         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -61,46 +61,39 @@ int	ft_atoll_overflow(const char *str, long long *res)
 	return (str[i] != '\0');
 }
 
-static char	*append_char(char *line, char c)
+/*long long to a malloc'd decimal string, LLONG_MIN included*/
+char	*ft_lltoa(long long n)
 {
-	size_t	len;
-	char	*new_line;
+	char				digits[21];
+	unsigned long long	u;
+	int					i;
 
-	if (!line)
-		len = 0;
-	else
-		len = ft_strlen(line);
-	new_line = malloc(len + 2);
-	if (!new_line)
-		return (free(line), NULL);
-	if (line)
-		ft_memcpy(new_line, line, len);
-	new_line[len] = c;
-	new_line[len + 1] = '\0';
-	free(line);
-	return (new_line);
+	u = (unsigned long long)n;
+	if (n < 0)
+		u = -u;
+	i = 20;
+	digits[i] = '\0';
+	while (u || i == 20)
+	{
+		digits[--i] = '0' + u % 10;
+		u /= 10;
+	}
+	if (n < 0)
+		digits[--i] = '-';
+	return (ft_strdup(digits + i));
 }
 
+/*Reads one line of script input. The fd is shared with the commands
+ * we run, so nothing past the '\n' may stay consumed: seekable input is
+ * read in blocks and rewound, pipes still go one byte at a time*/
 char	*read_line(void)
 {
-	char	c;
-	char	*line;
-	int		ret;
+	t_reader	rd;
+	char		*line;
 
-	line = NULL;
-	while (1)
-	{
-		ret = read(STDIN_FILENO, &c, 1);
-		if (ret <= 0)
-		{
-			if (!line)
-				return (NULL);
-			return (line);
-		}
-		if (c == '\n')
-			return (line);
-		line = append_char(line, c);
-		if (!line)
-			return (NULL);
-	}
+	reader_init(&rd, STDIN_FILENO);
+	reader_share(&rd, READER_LINE_CHUNK);
+	line = reader_line(&rd);
+	reader_unread(&rd);
+	return (line);
 }
@@ -0,0 +1,69 @@
+#!/usr/bin/env bash
+# Heredoc bodies belong to the line they were parsed with.
+#   tests/heredoc.sh [minishell]
+set -u
+
+SH=${1:-$(cd "$(dirname "$0")/.." && pwd)/minishell}
+FAIL=0
+
+# check NAME INPUT EXPECTED: runs INPUT as a script, compares its output
+check() {
+	local out
+	out=$(printf '%s' "$2" | "$SH" 2>&1)
+	if [ "$out" = "$3" ]; then
+		echo "ok   $1"
+	else
+		printf 'FAIL %s\n--- expected\n%s\n--- got\n%s\n' "$1" "$3" "$out"
+		FAIL=1
+	fi
+}
+
+check "skipped branch reads its body" \
+'false && cat <<EOF
+body line
+EOF
+echo after
+' 'after'
+
+check "loop replays its body" \
+'for i in 1 2; do cat <<EOF
+it $i
+EOF
+done
+' 'it 1
+it 2'
+
+check "quoted delimiter is not expanded" \
+'i=0
+while [ $i -lt 2 ]; do cat <<A; cat <<"B"
+a $i
+A
+b $i
+B
+i=$((i+1))
+done
+' 'a 0
+b $i
+a 1
+b $i'
+
+check "function body keeps its heredoc" \
+'f() { cat <<E
+in f $1
+E
+}
+f 1; f 2
+' 'in f 1
+in f 2'
+
+check "else branch body is skipped" \
+'if true; then cat <<A; else cat <<B; fi
+a
+A
+b
+B
+echo done
+' 'a
+done'
+
+exit $FAIL